@@ -0,0 +1,186 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <charconv>
+#include <format>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <phenyl/physics.h>
+#include <phenyl/runtime.h>
+
+#include "logging/logging.h"
+#include "logging/properties.h"
+#include "core/runtime/thread_pool.h"
+#include "util/profiler.h"
+
+#include "scenes.h"
+
+#define DEFAULT_STEPS 600
+#define WARMUP_STEPS 60
+#define FIXED_DELTA (1.0 / 60.0)
+
+using namespace phenyl;
+
+// Systems of the PhysicsUpdate stage, in the order they run
+static constexpr std::array<std::string_view, 9> SYSTEMS{
+    "RigidBody2D::Update",
+    "Collider2D::Sync",
+    "CircleCollider2D::Sync",
+    "BoxCollider2D::FrameTransform",
+    "Physics2D::ContinuousCollision",
+    "Physics2D::CollisionCheck",
+    "Physics2D::ConstraintsSolve",
+    "Collider2D::PostCollision",
+    "CircleCollider2D::PostCollision"
+};
+
+static constexpr std::array<std::string_view, 8> COUNTERS{
+    "physics.broadphase_candidates",
+    "physics.narrowphase_pairs",
+    "physics.contacts",
+    "physics.constraints",
+    "physics.solver_colours",
+    "physics.solver_largest_batch",
+    "physics.solver_iterations",
+    "physics.ccd_hits"
+};
+
+struct SceneResults {
+    std::array<double, SYSTEMS.size()> systemTimes{};
+    std::array<double, COUNTERS.size()> counters{};
+    double stepTime{0.0};
+};
+
+static void Step (PhenylRuntime& runtime) {
+    util::startProfileFrame();
+    runtime.runFixedTimestep(FIXED_DELTA);
+    util::endProfileFrame();
+}
+
+static SceneResults RunScene (const bench::Scene& scene, std::size_t steps, std::size_t workerThreads) {
+    SceneResults results;
+
+    PhenylRuntime runtime{workerThreads};
+    runtime.addPlugin<Physics2DPlugin>();
+    scene.build(runtime);
+    runtime.runPostInit();
+
+    // Let the scene settle into its steady state before measuring
+    for (std::size_t i = 0; i < WARMUP_STEPS; i++) {
+        Step(runtime);
+    }
+
+    for (std::size_t i = 0; i < steps; i++) {
+        Step(runtime);
+
+        results.stepTime += util::getProfileFrameTime();
+        for (std::size_t s = 0; s < SYSTEMS.size(); s++) {
+            results.systemTimes[s] += util::getProfileTime(std::string{SYSTEMS[s]});
+        }
+        for (std::size_t c = 0; c < COUNTERS.size(); c++) {
+            results.counters[c] += util::getProfileCounter(std::string{COUNTERS[c]});
+            // Counters are only written by systems that ran, so do not carry them over into the next scene
+            util::setProfileCounter(std::string{COUNTERS[c]}, 0.0);
+        }
+    }
+
+    runtime.shutdown();
+    return results;
+}
+
+// Runs an independent copy of the scene on each of worlds threads, and returns the total fixed steps per second
+static double RunParallel (const bench::Scene& scene, std::size_t steps, std::size_t worlds) {
+    std::vector<std::thread> threads;
+    threads.reserve(worlds);
+
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < worlds; i++) {
+        // Each world gets a core to itself, rather than its own thread pool
+        threads.emplace_back([&scene, steps] () {
+            RunScene(scene, steps, 0);
+        });
+    }
+    for (auto& i : threads) {
+        i.join();
+    }
+    auto time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    return static_cast<double>(worlds * (steps + WARMUP_STEPS)) / time;
+}
+
+static void ReportParallel (const bench::Scene& scene, std::size_t steps, std::size_t worlds) {
+    auto single = RunParallel(scene, steps, 1);
+    auto parallel = RunParallel(scene, steps, worlds);
+
+    std::cout << std::format("{} ({} steps, {} worlds)\n", scene.name, steps, worlds);
+    std::cout << std::format("  {:<36}{:>12.1f} steps/s\n", "1 world", single);
+    std::cout << std::format("  {:<36}{:>12.1f} steps/s\n", std::format("{} worlds", worlds), parallel);
+    std::cout << std::format("  {:<36}{:>12.2f}x\n", "scaling", parallel / single);
+    std::cout << "\n";
+}
+
+static void Report (const bench::Scene& scene, const SceneResults& results, std::size_t steps) {
+    auto perStep = [steps] (double value) {
+        return value / static_cast<double>(steps);
+    };
+
+    std::cout << std::format("{} ({} steps)\n", scene.name, steps);
+    std::cout << std::format("  {:<36}{:>12.4f} ms\n", "step", perStep(results.stepTime) * 1000.0);
+    for (std::size_t s = 0; s < SYSTEMS.size(); s++) {
+        std::cout << std::format("  {:<36}{:>12.4f} ms\n", SYSTEMS[s], perStep(results.systemTimes[s]) * 1000.0);
+    }
+    for (std::size_t c = 0; c < COUNTERS.size(); c++) {
+        std::cout << std::format("  {:<36}{:>12.1f}\n", COUNTERS[c], perStep(results.counters[c]));
+    }
+    std::cout << "\n";
+}
+
+// Usage: physics_bench [--worlds=N] [steps] [scene...]
+// Runs every scene by default. Times are averaged per fixed step, as are counters. With --worlds, instead runs N
+// independent runtimes of each scene in parallel and reports the total throughput against a single runtime.
+int main (int argc, char* argv[]) {
+    InitLogging(logging::LoggingProperties{}.withLogFile("physics_bench.log").withRootLogLevel(LEVEL_WARN));
+    util::setDetailedProfiling(true);
+
+    std::size_t steps = DEFAULT_STEPS;
+    std::size_t worlds = 0;
+    std::vector<std::string_view> sceneNames;
+    for (int i = 1; i < argc; i++) {
+        std::string_view arg{argv[i]};
+        std::size_t value;
+        if (arg.starts_with("--worlds=")) {
+            auto worldsArg = arg.substr(9);
+            if (std::from_chars(worldsArg.data(), worldsArg.data() + worldsArg.size(), worlds).ec != std::errc{} || !worlds) {
+                std::cerr << "Worlds must be a number greater than zero\n";
+                return 1;
+            }
+        } else if (std::from_chars(arg.data(), arg.data() + arg.size(), value).ec == std::errc{}) {
+            steps = value;
+        } else {
+            sceneNames.emplace_back(arg);
+        }
+    }
+
+    if (!steps) {
+        std::cerr << "Steps must be greater than zero\n";
+        return 1;
+    }
+
+    for (const auto& scene : bench::Scenes()) {
+        if (!sceneNames.empty() && std::ranges::find(sceneNames, scene.name) == sceneNames.end()) {
+            continue;
+        }
+
+        if (worlds) {
+            ReportParallel(scene, steps, worlds);
+        } else {
+            Report(scene, RunScene(scene, steps, core::ThreadPool::DefaultThreads()), steps);
+        }
+    }
+
+    ShutdownLogging();
+    return 0;
+}
@@ -0,0 +1,182 @@
+#include <array>
+
+#include <phenyl/components/2D/global_transform.h>
+#include <phenyl/components/physics/2D/rigid_body.h>
+#include <phenyl/components/physics/2D/static_body.h>
+#include <phenyl/components/physics/2D/continuous_collision.h>
+#include <phenyl/components/physics/2D/colliders/box_collider.h>
+#include <phenyl/components/physics/2D/colliders/circle_collider.h>
+#include <phenyl/world.h>
+
+#include "scenes.h"
+
+#define PILE_COLUMNS 20
+#define PILE_ROWS 20
+
+#define STORM_TARGETS 200
+#define STORM_BULLETS 500
+
+#define LEVEL_COLUMNS 200
+#define LEVEL_ROWS 25
+#define LEVEL_BODIES 100
+
+#define GRID_COLUMNS 20
+#define GRID_ROWS 10
+#define GRID_BALLS 50
+
+#define LAYER_WORLD 1
+#define LAYER_BODY 2
+#define LAYER_BULLET 4
+
+using namespace phenyl;
+
+// Bodies are placed with a fixed low discrepancy sequence so that every run simulates the same scene
+static float Sequence (std::size_t i) {
+    auto x = static_cast<float>(i) * 0.6180339887f;
+    return x - glm::floor(x);
+}
+
+static GlobalTransform2D MakeTransform (glm::vec2 position) {
+    GlobalTransform2D transform{};
+    transform.transform2D.setPosition(position);
+    return transform;
+}
+
+static BoxCollider2D MakeBox (glm::vec2 halfExtents, std::uint64_t layers, std::uint64_t mask, float elasticity) {
+    BoxCollider2D box{};
+    box.setScale(halfExtents);
+    box.layers = layers;
+    box.mask = mask;
+    box.elasticity = elasticity;
+    return box;
+}
+
+static CircleCollider2D MakeCircle (float radius, std::uint64_t layers, std::uint64_t mask, float elasticity) {
+    CircleCollider2D circle{};
+    circle.setRadius(radius);
+    circle.layers = layers;
+    circle.mask = mask;
+    circle.elasticity = elasticity;
+    return circle;
+}
+
+static RigidBody2D MakeBody (float mass, glm::vec2 gravity) {
+    RigidBody2D body{};
+    body.setMass(mass);
+    body.setInertia(mass * 0.1f);
+    body.gravity = gravity;
+    return body;
+}
+
+static void AddStaticBox (World& world, glm::vec2 position, glm::vec2 halfExtents, std::uint64_t layers, std::uint64_t mask) {
+    auto entity = world.create();
+    entity.insert(MakeTransform(position));
+    entity.insert(MakeBox(halfExtents, layers, mask, 0.5f));
+    entity.insert(StaticBody2D{});
+}
+
+void bench::BuildBoxPile (PhenylRuntime& runtime) {
+    auto& world = runtime.world();
+
+    AddStaticBox(world, {0.0f, -1.0f}, {2.0f, 0.05f}, LAYER_WORLD, LAYER_BODY);
+    AddStaticBox(world, {-2.0f, 0.0f}, {0.05f, 1.0f}, LAYER_WORLD, LAYER_BODY);
+    AddStaticBox(world, {2.0f, 0.0f}, {0.05f, 1.0f}, LAYER_WORLD, LAYER_BODY);
+
+    for (std::size_t i = 0; i < PILE_ROWS; i++) {
+        for (std::size_t j = 0; j < PILE_COLUMNS; j++) {
+            // Offset alternate rows so the pile topples rather than resting in perfect columns
+            auto offset = i % 2 ? 0.02f : -0.02f;
+            glm::vec2 pos{-1.0f + static_cast<float>(j) * 0.1f + offset, -0.9f + static_cast<float>(i) * 0.1f};
+
+            auto entity = world.create();
+            entity.insert(MakeTransform(pos));
+            entity.insert(MakeBody(1.0f, {0.0f, -9.8f}));
+            entity.insert(MakeBox({0.04f, 0.04f}, LAYER_BODY, LAYER_WORLD | LAYER_BODY, 0.1f));
+        }
+    }
+}
+
+void bench::BuildBulletStorm (PhenylRuntime& runtime) {
+    auto& world = runtime.world();
+
+    for (std::size_t i = 0; i < STORM_TARGETS; i++) {
+        glm::vec2 pos{Sequence(i) * 4.0f - 2.0f, Sequence(i + STORM_TARGETS) * 4.0f - 2.0f};
+        AddStaticBox(world, pos, {0.02f, 0.1f}, LAYER_WORLD, LAYER_BULLET);
+    }
+
+    for (std::size_t i = 0; i < STORM_BULLETS; i++) {
+        auto angle = Sequence(i) * 2.0f * glm::pi<float>();
+        glm::vec2 direction{glm::cos(angle), glm::sin(angle)};
+
+        auto body = MakeBody(0.01f, {0.0f, 0.0f});
+        // Fast enough to cross a target in a single step at 60 steps per second
+        body.applyImpulse(direction * 0.01f * 30.0f);
+
+        auto entity = world.create();
+        entity.insert(MakeTransform(direction * 0.1f));
+        entity.insert(std::move(body));
+        entity.insert(MakeCircle(0.01f, LAYER_BULLET, LAYER_WORLD, 1.0f));
+        entity.insert(ContinuousCollision2D{});
+    }
+}
+
+void bench::BuildWideStaticLevel (PhenylRuntime& runtime) {
+    auto& world = runtime.world();
+
+    for (std::size_t i = 0; i < LEVEL_ROWS; i++) {
+        for (std::size_t j = 0; j < LEVEL_COLUMNS; j++) {
+            glm::vec2 pos{static_cast<float>(j) * 0.1f - 10.0f, -1.0f - static_cast<float>(i) * 0.1f};
+            AddStaticBox(world, pos, {0.05f, 0.05f}, LAYER_WORLD, LAYER_BODY);
+        }
+    }
+
+    for (std::size_t i = 0; i < LEVEL_BODIES; i++) {
+        glm::vec2 pos{Sequence(i) * 20.0f - 10.0f, Sequence(i + LEVEL_BODIES)};
+
+        auto entity = world.create();
+        entity.insert(MakeTransform(pos));
+        entity.insert(MakeBody(1.0f, {0.0f, -9.8f}));
+        entity.insert(MakeBox({0.04f, 0.04f}, LAYER_BODY, LAYER_WORLD | LAYER_BODY, 0.1f));
+    }
+}
+
+void bench::BuildBreakoutGrid (PhenylRuntime& runtime) {
+    auto& world = runtime.world();
+
+    // Same layout and layers as the breakout example
+    AddStaticBox(world, {-1.0f, 0.0f}, {0.04f, 1.0f}, LAYER_WORLD, LAYER_BULLET);
+    AddStaticBox(world, {1.0f, 0.0f}, {0.04f, 1.0f}, LAYER_WORLD, LAYER_BULLET);
+    AddStaticBox(world, {0.0f, 1.0f}, {1.0f, 0.04f}, LAYER_WORLD, LAYER_BULLET);
+    AddStaticBox(world, {0.0f, -1.0f}, {1.0f, 0.04f}, LAYER_WORLD, LAYER_BULLET);
+
+    for (std::size_t i = 0; i < GRID_ROWS; i++) {
+        for (std::size_t j = 0; j < GRID_COLUMNS; j++) {
+            glm::vec2 pos{-0.9f + static_cast<float>(j) * 0.095f, 0.3f + static_cast<float>(i) * 0.06f};
+            AddStaticBox(world, pos, {0.045f, 0.025f}, LAYER_WORLD, LAYER_BULLET);
+        }
+    }
+
+    for (std::size_t i = 0; i < GRID_BALLS; i++) {
+        auto angle = Sequence(i) * glm::pi<float>();
+        glm::vec2 direction{glm::cos(angle), glm::sin(angle)};
+
+        auto body = MakeBody(0.001f, {0.0f, 0.0f});
+        body.applyImpulse(direction * 0.001f * 1.5f);
+
+        auto entity = world.create();
+        entity.insert(MakeTransform({Sequence(i + GRID_BALLS) * 1.6f - 0.8f, -0.5f}));
+        entity.insert(std::move(body));
+        entity.insert(MakeCircle(0.03125f, LAYER_BULLET, LAYER_WORLD, 1.0f));
+    }
+}
+
+std::span<const bench::Scene> bench::Scenes () {
+    static const std::array<Scene, 4> SCENES{{
+        {"box_pile", BuildBoxPile},
+        {"bullet_storm", BuildBulletStorm},
+        {"wide_static_level", BuildWideStaticLevel},
+        {"breakout_grid", BuildBreakoutGrid}
+    }};
+
+    return SCENES;
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <span>
+#include <string_view>
+
+#include <phenyl/runtime.h>
+
+namespace phenyl::bench {
+    struct Scene {
+        std::string_view name;
+        void (*build) (PhenylRuntime& runtime);
+    };
+
+    // Box pile: dynamic boxes stacked on a static floor under gravity
+    void BuildBoxPile (PhenylRuntime& runtime);
+    // Bullet storm: fast continuous collision circles fired through a field of static targets
+    void BuildBulletStorm (PhenylRuntime& runtime);
+    // Wide static level: a large static tile map with a few dynamic bodies falling onto it
+    void BuildWideStaticLevel (PhenylRuntime& runtime);
+    // Breakout grid: a grid of static tiles inside static walls with several balls bouncing around
+    void BuildBreakoutGrid (PhenylRuntime& runtime);
+
+    std::span<const Scene> Scenes ();
+}
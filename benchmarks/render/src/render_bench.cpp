@@ -0,0 +1,234 @@
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <format>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <phenyl/components/2D/global_transform.h>
+#include <phenyl/components/2D/sprite.h>
+#include <phenyl/runtime.h>
+#include <phenyl/world.h>
+
+#include "core/assets/assets.h"
+#include "core/debug.h"
+#include "core/runtime/thread_pool.h"
+#include "graphics/camera.h"
+#include "graphics/phenyl_graphics.h"
+#include "graphics/plugins/graphics_plugin.h"
+#include "graphics/plugins/sprite_2d_plugin.h"
+#include "logging/logging.h"
+#include "logging/properties.h"
+#include "util/profiler.h"
+
+#define DEFAULT_FRAMES 300
+#define WARMUP_FRAMES 30
+#define DEFAULT_SPRITES 100000
+#define TEXTURE_SIZE 16
+#define DEBUG_SHAPES 1000
+
+using namespace phenyl;
+
+struct RenderScene {
+    std::string_view name;
+    std::function<void(PhenylRuntime&, std::size_t)> build;
+};
+
+// Systems of the Render stage and render layers, in the order they run
+static constexpr std::array<std::string_view, 4> CATEGORIES{
+    "EntityRender::BufferEntities",
+    "Graphics::DebugRender",
+    "EntityRenderLayer",
+    "DebugLayer"
+};
+
+struct RenderResults {
+    std::array<double, CATEGORIES.size()> times{};
+    double frameTime{0.0};
+    std::size_t draws{0};
+    std::size_t samplerBinds{0};
+    std::size_t elidedBinds{0};
+    std::size_t uploads{0};
+    std::size_t uploadedBytes{0};
+};
+
+// Bodies are placed with a fixed low discrepancy sequence so that every run draws the same scene
+static float Sequence (std::size_t i) {
+    auto x = static_cast<float>(i) * 0.6180339887f;
+    return x - glm::floor(x);
+}
+
+static core::Asset<graphics::Texture> MakeTexture (graphics::Renderer& renderer, std::size_t index) {
+    graphics::Image image{TEXTURE_SIZE, TEXTURE_SIZE, graphics::ImageFormat::RGBA};
+    graphics::TextureProperties properties{
+        .format = graphics::ImageFormat::RGBA,
+        .filter = graphics::TextureFilter::POINT,
+        .useMipmapping = false
+    };
+
+    return core::Assets::LoadVirtual<graphics::Texture>(std::format("render_bench/texture_{}", index), renderer.makeTexture(properties, image));
+}
+
+// Sprites are spread over [-extent, extent]^2, while the camera sees [-1, 1]^2
+static void BuildSprites (PhenylRuntime& runtime, std::size_t sprites, std::size_t textures, float extent = 1.0f, bool isStatic = false) {
+    std::vector<core::Asset<graphics::Texture>> textureAssets;
+    for (std::size_t i = 0; i < textures; i++) {
+        textureAssets.emplace_back(MakeTexture(runtime.resource<graphics::Renderer>(), i));
+    }
+
+    for (std::size_t i = 0; i < sprites; i++) {
+        GlobalTransform2D transform{};
+        transform.transform2D.setPosition(glm::vec2{Sequence(i) * 2.0f - 1.0f, Sequence(i + sprites) * 2.0f - 1.0f} * extent);
+        transform.transform2D.setScale({0.01f, 0.01f});
+
+        auto entity = runtime.world().create();
+        entity.insert(transform);
+        entity.insert(Sprite2D{.texture = textureAssets[i % textures]});
+        if (isStatic) {
+            entity.insert(StaticSprite2D{});
+        }
+    }
+}
+
+// Debug shapes are queued every frame
+static void DebugShapesSystem (const core::Resources<const graphics::Camera>& resources) {
+    for (std::size_t i = 0; i < DEBUG_SHAPES; i++) {
+        glm::vec2 pos{Sequence(i) * 2.0f - 1.0f, Sequence(i + DEBUG_SHAPES) * 2.0f - 1.0f};
+        core::debugWorldRect(pos, pos + glm::vec2{0.01f, 0.01f}, {1, 0, 0, 1}, {1, 1, 1, 1});
+        core::debugWorldLine(pos, -pos, {0, 1, 0, 1});
+    }
+}
+
+static const std::vector<RenderScene>& Scenes () {
+    static const std::vector<RenderScene> scenes{
+        {"sprites_1_texture", [] (PhenylRuntime& runtime, std::size_t sprites) { BuildSprites(runtime, sprites, 1); }},
+        {"sprites_16_textures", [] (PhenylRuntime& runtime, std::size_t sprites) { BuildSprites(runtime, sprites, 16); }},
+        {"sprites_large_level", [] (PhenylRuntime& runtime, std::size_t sprites) { BuildSprites(runtime, sprites, 1, 10.0f); }},
+        {"static_large_level", [] (PhenylRuntime& runtime, std::size_t sprites) { BuildSprites(runtime, sprites, 1, 10.0f, true); }},
+        {"debug_shapes", [] (PhenylRuntime& runtime, std::size_t) {
+            runtime.addSystem<core::Render>("RenderBench::DebugShapes", DebugShapesSystem);
+        }}
+    };
+
+    return scenes;
+}
+
+static RenderResults RunScene (const RenderScene& scene, std::size_t frames, std::size_t sprites, std::size_t workerThreads) {
+    RenderResults results;
+    graphics::RenderCommandLog log;
+
+    PhenylRuntime runtime{workerThreads};
+    // Bound until the renderer and scene textures are destroyed
+    auto assetScope = runtime.makeCurrent();
+    auto renderer = graphics::MakeNullRenderer(graphics::GraphicsProperties{}, &log);
+    runtime.addResource(renderer.get());
+    runtime.addPlugin<graphics::GraphicsPlugin>();
+    runtime.addPlugin<graphics::Sprite2DPlugin>();
+
+    scene.build(runtime, sprites);
+    runtime.runPostInit();
+
+    auto frame = [&] () {
+        util::startProfileFrame();
+        runtime.runRender();
+        util::startProfile("render");
+        renderer->render();
+        util::endProfile();
+        util::endProfileFrame();
+    };
+
+    for (std::size_t i = 0; i < WARMUP_FRAMES; i++) {
+        frame();
+    }
+
+    log.clear();
+    for (std::size_t i = 0; i < frames; i++) {
+        frame();
+
+        results.frameTime += util::getProfileFrameTime();
+        for (std::size_t c = 0; c < CATEGORIES.size(); c++) {
+            results.times[c] += util::getProfileTime(std::string{CATEGORIES[c]});
+        }
+    }
+
+    PHENYL_ASSERT(log.frames() == frames);
+    results.draws = log.count(graphics::RenderCommandType::DRAW);
+    results.samplerBinds = log.count(graphics::RenderCommandType::SAMPLER_BIND);
+    results.elidedBinds = log.count(graphics::RenderCommandType::ELIDED_BIND);
+    results.uploads = log.count(graphics::RenderCommandType::BUFFER_UPLOAD) + log.count(graphics::RenderCommandType::UNIFORM_UPLOAD) + log.count(graphics::RenderCommandType::TEXTURE_UPLOAD);
+    results.uploadedBytes = log.uploadedBytes();
+
+    runtime.shutdown();
+    renderer->clearLayers();
+    return results;
+}
+
+static void Report (const RenderScene& scene, const RenderResults& results, std::size_t frames) {
+    auto perFrame = [frames] (double value) {
+        return value / static_cast<double>(frames);
+    };
+
+    std::cout << std::format("{} ({} frames)\n", scene.name, frames);
+    std::cout << std::format("  {:<36}{:>12.4f} ms\n", "frame", perFrame(results.frameTime) * 1000.0);
+    for (std::size_t c = 0; c < CATEGORIES.size(); c++) {
+        std::cout << std::format("  {:<36}{:>12.4f} ms\n", CATEGORIES[c], perFrame(results.times[c]) * 1000.0);
+    }
+    std::cout << std::format("  {:<36}{:>12.1f}\n", "draw calls", perFrame(static_cast<double>(results.draws)));
+    std::cout << std::format("  {:<36}{:>12.1f}\n", "sampler binds", perFrame(static_cast<double>(results.samplerBinds)));
+    std::cout << std::format("  {:<36}{:>12.1f}\n", "elided binds", perFrame(static_cast<double>(results.elidedBinds)));
+    std::cout << std::format("  {:<36}{:>12.1f}\n", "uploads", perFrame(static_cast<double>(results.uploads)));
+    std::cout << std::format("  {:<36}{:>12.1f}\n", "uploaded bytes", perFrame(static_cast<double>(results.uploadedBytes)));
+    std::cout << "\n";
+}
+
+// Usage: render_bench [--sprites=N] [--threads=N] [frames] [scene...]
+// Runs the render layers against the recording null renderer, so needs no GPU. Runs every scene by default. Times and
+// command counts are averaged per frame.
+int main (int argc, char* argv[]) {
+    InitLogging(logging::LoggingProperties{}.withLogFile("render_bench.log").withRootLogLevel(LEVEL_WARN));
+    util::setDetailedProfiling(true);
+
+    std::size_t frames = DEFAULT_FRAMES;
+    std::size_t sprites = DEFAULT_SPRITES;
+    std::size_t workerThreads = core::ThreadPool::DefaultThreads();
+    std::vector<std::string_view> sceneNames;
+    for (int i = 1; i < argc; i++) {
+        std::string_view arg{argv[i]};
+        std::size_t value;
+        if (arg.starts_with("--sprites=")) {
+            auto spritesArg = arg.substr(10);
+            if (std::from_chars(spritesArg.data(), spritesArg.data() + spritesArg.size(), sprites).ec != std::errc{}) {
+                std::cerr << "Sprites must be a number\n";
+                return 1;
+            }
+        } else if (arg.starts_with("--threads=")) {
+            auto threadsArg = arg.substr(10);
+            if (std::from_chars(threadsArg.data(), threadsArg.data() + threadsArg.size(), workerThreads).ec != std::errc{}) {
+                std::cerr << "Threads must be a number\n";
+                return 1;
+            }
+        } else if (std::from_chars(arg.data(), arg.data() + arg.size(), value).ec == std::errc{}) {
+            frames = value;
+        } else {
+            sceneNames.emplace_back(arg);
+        }
+    }
+
+    if (!frames) {
+        std::cerr << "Frames must be greater than zero\n";
+        return 1;
+    }
+
+    for (const auto& scene : Scenes()) {
+        if (!sceneNames.empty() && std::ranges::find(sceneNames, scene.name) == sceneNames.end()) {
+            continue;
+        }
+
+        Report(scene, RunScene(scene, frames, sprites, workerThreads), frames);
+    }
+
+    ShutdownLogging();
+    return 0;
+}
@@ -3,6 +3,7 @@
 #include <phenyl/debug.h>
 #include <phenyl/entrypoint.h>
 #include <phenyl/level.h>
+#include <phenyl/physics.h>
 #include <phenyl/ui/ui.h>
 
 #include "test_app.h"
@@ -21,6 +22,9 @@ test::TestApp::TestApp (phenyl::ApplicationProperties properties) :
         .withVsync(false)) {}
 
 void test::TestApp::init () {
+    // Bullets use per-contact OnCollision handlers
+    runtime().resource<phenyl::CollisionEvents2D>().raiseSignals = true;
+
     InitBullet(this, world());
     InitPlayer(this);
 
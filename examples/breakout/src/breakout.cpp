@@ -8,6 +8,8 @@
 #include <phenyl/debug.h>
 #include <phenyl/entrypoint.h>
 #include <phenyl/level.h>
+#include <phenyl/physics.h>
+#include <phenyl/spatial_order.h>
 #include <phenyl/ui/ui.h>
 
 #include "ball.h"
@@ -43,6 +45,12 @@ BreakoutApp::BreakoutApp (phenyl::ApplicationProperties properties) : phenyl::Ap
 }
 
 void BreakoutApp::init () {
+    // Gameplay uses per-contact OnCollision handlers
+    runtime().resource<phenyl::CollisionEvents2D>().raiseSignals = true;
+    // Keep the tile grid in spatial order for the broadphase and renderer
+    runtime().addPlugin<phenyl::SpatialOrder2DPlugin>();
+    runtime().resource<phenyl::SpatialOrder2D>().select<phenyl::BoxCollider2D>();
+
     breakout::InitPaddle(this, runtime());
     breakout::InitBall(this, world());
     breakout::InitTile(this, world());
@@ -4,6 +4,7 @@
 
 #include <phenyl/world.h>
 #include <phenyl/components/2D/global_transform.h>
+#include <phenyl/components/physics/2D/static_body.h>
 #include <phenyl/signals/lifecycle.h>
 
 #include "breakout.h"
@@ -47,9 +48,7 @@ void TileController::onInsert (phenyl::Entity entity, BreakoutApp* app, phenyl::
         for (std::size_t j = 0; j < columns; j++) {
             auto tileEntity = entity.createChild();
             tile->instantiate(tileEntity);
-            tileEntity.apply<phenyl::GlobalTransform2D>([pos] (phenyl::GlobalTransform2D& transform) {
-                transform.transform2D.setPosition(pos);
-            });
+            phenyl::StaticBody2D::Move(tileEntity, pos);
 
             pos += glm::vec2{xIncrement, 0};
         }
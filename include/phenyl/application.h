@@ -20,6 +20,9 @@ namespace phenyl {
             double targetFrameTime{1.0 / 60};
             double targetFps{60};
             double fixedTimeScale{1.0};
+            double fixedFps{60};
+            std::size_t maxFixedSteps{5};
+            bool quitRequested{false};
 
             virtual void _init () = 0;
             ApplicationBase (ApplicationProperties properties);
@@ -30,8 +33,14 @@ namespace phenyl {
         protected:
             core::World& world ();
 
+            // Paces frames to the target rate. A rate of 0 or less runs frames as fast as possible.
             void setTargetFPS (double fps);
             void setFixedTimeScale (double newTimeScale);
+            // Rate of the fixed timestep, i.e. physics. Fast bodies should use ContinuousCollision2D at low rates.
+            void setFixedFPS (double fps);
+            // Most fixed timesteps run to catch up on a single frame. Time beyond that is dropped, slowing the simulation
+            // down rather than letting slow frames cause ever more fixed timesteps.
+            void setMaxFixedSteps (std::size_t steps);
         public:
             virtual ~ApplicationBase() = default;
 
@@ -42,6 +51,12 @@ namespace phenyl {
 
             void pause ();
             void resume ();
+            // Stops the game loop at the end of the current frame
+            void quit ();
+
+            bool isQuitting () const {
+                return quitRequested;
+            }
 
             template <phenyl::core::SerializableType T>
             void addComponent (std::string name) {
@@ -66,6 +81,14 @@ namespace phenyl {
             double getTargetFps () const {
                 return targetFps;
             }
+
+            double getFixedFps () const {
+                return fixedFps;
+            }
+
+            std::size_t getMaxFixedSteps () const {
+                return maxFixedSteps;
+            }
         };
     }
 
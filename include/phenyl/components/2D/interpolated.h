@@ -0,0 +1,8 @@
+#pragma once
+
+#include "core/transform_interpolation_2d.h"
+
+namespace phenyl {
+    using Interpolated2D = phenyl::core::Interpolated2D;
+    using TransformInterpolation2D = phenyl::core::TransformInterpolation2D;
+}
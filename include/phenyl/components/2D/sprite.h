@@ -4,4 +4,5 @@
 
 namespace phenyl {
     using Sprite2D = phenyl::graphics::Sprite2D;
+    using StaticSprite2D = phenyl::graphics::StaticSprite2D;
 }
\ No newline at end of file
@@ -0,0 +1,7 @@
+#pragma once
+
+#include "physics/components/2D/colliders/circle_collider.h"
+
+namespace phenyl {
+    using CircleCollider2D = phenyl::physics::CircleCollider2D;
+}
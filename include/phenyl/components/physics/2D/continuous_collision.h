@@ -0,0 +1,7 @@
+#pragma once
+
+#include "physics/components/2D/continuous_collision.h"
+
+namespace phenyl {
+    using ContinuousCollision2D = phenyl::physics::ContinuousCollision2D;
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+#include "physics/components/2D/static_body.h"
+
+namespace phenyl {
+    using StaticBody2D = phenyl::physics::StaticBody2D;
+}
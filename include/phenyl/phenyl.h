@@ -8,10 +8,13 @@
 #include "font.h"
 #include "input.h"
 #include "level.h"
+#include "physics.h"
 #include "plugin.h"
 #include "prefab.h"
 #include "properties.h"
 #include "resource.h"
+#include "spatial_order.h"
+#include "world_partition.h"
 #include "runtime.h"
 #include "serialization.h"
 #include "transform_2d.h"
@@ -19,12 +22,16 @@
 #include "ui/ui.h"
 
 #include "components/2D/global_transform.h"
+#include "components/2D/interpolated.h"
 #include "components/2D/sprite.h"
 #include "components/2D/particle_emitter.h"
 
 #include "components/physics/2D/rigid_body.h"
 #include "components/physics/2D/collider.h"
 #include "components/physics/2D/colliders/box_collider.h"
+#include "components/physics/2D/colliders/circle_collider.h"
+#include "components/physics/2D/continuous_collision.h"
+#include "components/physics/2D/static_body.h"
 
 #include "graphics/graphics.h"
 
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "physics/collision_events.h"
+#include "physics/collision_layers.h"
+#include "physics/physics.h"
+#include "physics/spatial_queries.h"
+
+namespace phenyl {
+    using CollisionLayers2D = phenyl::physics::CollisionLayers2D;
+    using CollisionEvents2D = phenyl::physics::CollisionEvents2D;
+    using CollisionEvent2D = phenyl::physics::CollisionEvent2D;
+    using CollisionEventType2D = phenyl::physics::CollisionEventType2D;
+    using SpatialQueries2D = phenyl::physics::SpatialQueries2D;
+    using QueryHit2D = phenyl::physics::QueryHit2D;
+    using Ray2D = phenyl::physics::Ray2D;
+
+    using Physics2DPlugin = phenyl::physics::Physics2DPlugin;
+}
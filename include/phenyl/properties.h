@@ -38,6 +38,14 @@ namespace phenyl {
             return *this;
         }
 
+        // Runs without a window or GPU, e.g. for dedicated servers and benchmarks. With no target FPS, frames are not
+        // paced and each frame advances the simulation by one fixed timestep.
+        ApplicationProperties& withHeadless (const bool headless) {
+            graphicsProperties.withHeadless(headless);
+
+            return *this;
+        }
+
         ApplicationProperties& withLogFile (std::string logFile) {
             loggingProperties.withLogFile(std::move(logFile));
 
@@ -0,0 +1,9 @@
+#pragma once
+
+#include "core/spatial_order_2d.h"
+#include "core/plugins/spatial_order_plugin_2d.h"
+
+namespace phenyl {
+    using SpatialOrder2D = phenyl::core::SpatialOrder2D;
+    using SpatialOrder2DPlugin = phenyl::core::SpatialOrder2DPlugin;
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "core/components/frozen.h"
+#include "core/world_partition_2d.h"
+#include "core/plugins/world_partition_plugin_2d.h"
+
+namespace phenyl {
+    using Frozen = phenyl::core::Frozen;
+    using Reduced = phenyl::core::Reduced;
+    using PartitionFocus2D = phenyl::core::PartitionFocus2D;
+    using CellActivity2D = phenyl::core::CellActivity2D;
+    using WorldPartition2D = phenyl::core::WorldPartition2D;
+    using WorldPartition2DPlugin = phenyl::core::WorldPartition2DPlugin;
+}
@@ -112,17 +112,16 @@ namespace phenyl::core {
             }
         };
     }
+    // Each runtime owns its assets, as asset managers are registered by its plugins, so assets are not shared between
+    // runtimes and each loads its own copy. The static functions use the instance bound to the calling thread by an
+    // AssetScope, which a runtime holds whenever it is used.
     class Assets {
     private:
-        static Assets* INSTANCE;
+        static thread_local Assets* CURRENT;
 
         static Assets* GetInstance () {
-            if (!INSTANCE) {
-                [[unlikely]]
-                INSTANCE = new Assets();
-            }
-
-            return INSTANCE;
+            PHENYL_ASSERT_MSG(CURRENT, "Assets used outside of a runtime, bind one with PhenylRuntime::makeCurrent()");
+            return CURRENT;
         }
 
         util::Map<std::size_t, std::unique_ptr<detail::AssetCacheBase>> caches;
@@ -258,7 +257,16 @@ namespace phenyl::core {
 
         friend detail::AssetManagerBase;
         friend detail::AssetBase;
+        friend AssetScope;
     public:
+        Assets () = default;
+        Assets (const Assets&) = delete;
+        Assets& operator= (const Assets&) = delete;
+
+        ~Assets () {
+            PHENYL_ASSERT_MSG(CURRENT != this, "Assets destroyed while still bound");
+        }
+
         template <typename T>
         static Asset<T> Load (const std::string& path) {
             return GetInstance()->load<T>(path);
@@ -280,6 +288,23 @@ namespace phenyl::core {
         }
     };
 
+    // Binds an Assets instance to the calling thread for the lifetime of the scope, then restores the one bound before
+    class AssetScope {
+    private:
+        Assets* previous;
+    public:
+        explicit AssetScope (Assets& assets) noexcept : previous{Assets::CURRENT} {
+            Assets::CURRENT = &assets;
+        }
+
+        AssetScope (const AssetScope&) = delete;
+        AssetScope& operator= (const AssetScope&) = delete;
+
+        ~AssetScope () {
+            Assets::CURRENT = previous;
+        }
+    };
+
     namespace detail {
         template <typename T>
         class AssetSerializable : public ISerializable<Asset<T>> {
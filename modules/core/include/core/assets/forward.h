@@ -2,6 +2,7 @@
 
 namespace phenyl::core {
     class Assets;
+    class AssetScope;
 
     template <typename T>
     class Asset;
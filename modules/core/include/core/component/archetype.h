@@ -123,6 +123,11 @@ namespace phenyl::core {
             return entityIds.size();
         }
 
+        [[nodiscard]] EntityId getEntityId (std::size_t pos) const noexcept {
+            PHENYL_DASSERT(pos < size());
+            return entityIds[pos];
+        }
+
         template <typename T>
         T& get (std::size_t pos) {
             PHENYL_DASSERT(pos < size());
@@ -150,6 +155,8 @@ namespace phenyl::core {
         }
 
         void remove (std::size_t pos);
+        // Swaps the rows of two entities, invalidating any component pointers to either
+        void swapRows (std::size_t pos1, std::size_t pos2);
 
         template <typename T, typename ...Args>
         void addComponent (std::size_t pos, Args&&... args) {
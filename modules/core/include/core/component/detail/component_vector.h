@@ -23,6 +23,7 @@ namespace phenyl::core {
         virtual void moveComp (std::byte* from, std::byte* to) = 0;
         virtual void moveConstructComp (std::byte* from, std::byte* to) = 0;
         virtual void deleteComp (std::byte* comp) = 0;
+        virtual void swapComps (std::byte* comp1, std::byte* comp2) = 0;
         virtual void moveAllComps (std::byte* start, std::byte* end, std::byte* newStart) = 0;
         virtual void deleteAllComps (std::byte* start, std::byte* end) = 0;
 
@@ -61,6 +62,7 @@ namespace phenyl::core {
         std::byte* insertUntyped ();
         void moveFrom (UntypedComponentVector& other, std::size_t pos);
         void remove (std::size_t pos);
+        void swap (std::size_t pos1, std::size_t pos2);
         void clear ();
 
 
@@ -102,6 +104,11 @@ namespace phenyl::core {
             compTyped->~T();
         }
 
+        void swapComps (std::byte* comp1, std::byte* comp2) override {
+            using std::swap;
+            swap(*reinterpret_cast<T*>(comp1), *reinterpret_cast<T*>(comp2));
+        }
+
         void moveAllComps (std::byte* start, std::byte* end, std::byte* newStart) override {
             auto* startTyped = reinterpret_cast<T*>(start);
             auto* endTyped = reinterpret_cast<T*>(end);
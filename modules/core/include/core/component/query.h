@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <unordered_set>
 #include <vector>
@@ -12,10 +13,16 @@ namespace phenyl::core {
     private:
         World& world;
         detail::ArchetypeKey key;
+        bool skipFrozen;
+        // Archetypes with this component are skipped, 0 skips none
+        std::size_t excludedType;
         std::unordered_set<Archetype*> archetypes;
+        // Archetypes of reduced entities, which replace the others during reduced steps if skipFrozen is set
+        std::unordered_set<Archetype*> reducedArchetypes;
 
+        [[nodiscard]] const std::unordered_set<Archetype*>& current () const noexcept;
     public:
-        explicit QueryArchetypes (World& world, detail::ArchetypeKey key);
+        explicit QueryArchetypes (World& world, detail::ArchetypeKey key, bool skipFrozen = false, std::size_t excludedType = 0);
         class Iterator {
         private:
             std::unordered_set<Archetype*>::const_iterator it;
@@ -47,32 +54,40 @@ namespace phenyl::core {
             return key;
         }
 
+        [[nodiscard]] bool skipsFrozen () const noexcept {
+            return skipFrozen;
+        }
+
+        [[nodiscard]] std::size_t getExcludedType () const noexcept {
+            return excludedType;
+        }
+
         void onNewArchetype (Archetype* archetype);
 
         iterator begin () {
-            return iterator{archetypes.begin()};
+            return iterator{current().begin()};
         }
 
         iterator end () {
-            return iterator{archetypes.end()};
+            return iterator{current().end()};
         }
 
         const_iterator begin () const {
             return cbegin();
         }
         const_iterator cbegin () const {
-            return const_iterator{archetypes.begin()};
+            return const_iterator{current().begin()};
         }
 
         const_iterator end () const {
             return cend();
         }
         const_iterator cend () const {
-            return const_iterator{archetypes.end()};
+            return const_iterator{current().end()};
         }
 
         bool contains (Archetype* archetype) const noexcept {
-            return archetypes.contains(archetype);
+            return current().contains(archetype);
         }
 
         void lock ();
@@ -88,6 +103,9 @@ namespace phenyl::core {
     template <typename F, typename ...Args>
     concept Query2BundleCallback = meta::callable<F, void, const Bundle<Args...>&>;
 
+    template <typename F, typename ...Args>
+    concept Query2IndexedCallback = meta::callable<F, void, std::size_t, std::remove_reference_t<Args>&...>;
+
     template <typename ...Args>
     class Query {
     private:
@@ -149,6 +167,42 @@ namespace phenyl::core {
             archetypes->unlock();
         }
 
+        // Number of entities matched by the query
+        [[nodiscard]] std::size_t size () const {
+            PHENYL_DASSERT(*this);
+            std::size_t count = 0;
+            for (auto& archetype : *archetypes) {
+                count += archetype.size();
+            }
+
+            return count;
+        }
+
+        // Calls fn on the entities in [start, end) of the iteration order, along with their index in it. The order is
+        // stable while no entities are added, removed or change archetype, so disjoint ranges may be run concurrently as
+        // long as fn does not change the world.
+        void eachRange (std::size_t start, std::size_t end, const Query2IndexedCallback<Args...> auto& fn) const {
+            PHENYL_DASSERT(*this);
+            std::size_t archetypeStart = 0;
+            for (auto& archetype : *archetypes) {
+                auto archetypeEnd = archetypeStart + archetype.size();
+                if (archetypeEnd <= start) {
+                    archetypeStart = archetypeEnd;
+                    continue;
+                } else if (archetypeStart >= end) {
+                    break;
+                }
+
+                ArchetypeView<Args...> view{archetype, manager};
+                auto it = view.begin();
+                for (auto i = std::max(start, archetypeStart); i < std::min(end, archetypeEnd); i++) {
+                    auto comps = it[static_cast<std::ptrdiff_t>(i - archetypeStart)];
+                    fn(i, std::get<std::remove_reference_t<Args>&>(comps)...);
+                }
+                archetypeStart = archetypeEnd;
+            }
+        }
+
         void entity (Entity entity, const Query2BundleCallback<Args...> auto& fn) const {
             PHENYL_DASSERT(*this);
             const auto& entry = entity.entry();
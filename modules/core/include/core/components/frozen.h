@@ -0,0 +1,12 @@
+#pragma once
+
+namespace phenyl::core {
+    // Marks an entity as frozen. Active queries, including those of systems in the simulation stages, do not see
+    // frozen entities. Plain queries still do, so frozen entities are still rendered, collided with and passed to pair
+    // systems.
+    struct Frozen {};
+
+    // Marks a frozen entity that is still simulated at a reduced rate. Outside of reduced steps it is frozen like any
+    // other, and in reduced steps active queries only see reduced entities, see World::reducedStep().
+    struct Reduced {};
+}
@@ -52,5 +52,8 @@ namespace phenyl::core {
         [[nodiscard]] inline glm::vec2 apply (glm::vec2 vec) const {
             return getMatrix() * vec + position();
         }
+
+        // Blends between two transforms, rotating along the shortest arc
+        [[nodiscard]] static Transform2D Interpolate (const Transform2D& from, const Transform2D& to, float t);
     };
 }
\ No newline at end of file
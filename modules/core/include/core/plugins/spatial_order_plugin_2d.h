@@ -0,0 +1,12 @@
+#pragma once
+
+#include "core/plugin.h"
+
+namespace phenyl::core {
+    class SpatialOrder2DPlugin : public IInitPlugin {
+    public:
+        SpatialOrder2DPlugin () = default;
+        std::string_view getName() const noexcept override;
+        void init (PhenylRuntime &runtime) override;
+    };
+}
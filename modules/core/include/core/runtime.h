@@ -3,6 +3,7 @@
 #include <concepts>
 
 #include "core/world.h"
+#include "core/assets/forward.h"
 #include "core/serialization/component_serializer.h"
 #include "util/set.h"
 
@@ -17,6 +18,11 @@ namespace phenyl::core {
 
     class PhenylRuntime {
     private:
+        // Declared first so that it outlives anything holding assets
+        std::unique_ptr<Assets> runtimeAssets;
+        // Keeps runtimeAssets bound while the other members are destroyed
+        std::unique_ptr<AssetScope> destructionScope;
+
         World runtimeWorld;
         core::EntityComponentSerializer entitySerializer;
 
@@ -28,6 +34,17 @@ namespace phenyl::core {
         std::unordered_map<std::string, std::unique_ptr<IRunnableSystem>> systemMap;
         std::unordered_map<std::size_t, std::unique_ptr<AbstractStage>> stageMap;
 
+        // Time skipped by reduced entities since their last reduced step, see World::reducedInterval()
+        struct ReducedTime {
+            double time = 0.0;
+            std::uint64_t steps = 0;
+        };
+        ReducedTime reducedFixedTime;
+        ReducedTime reducedVariableTime;
+
+        template <typename S, typename Delta>
+        void runReducedStep (ReducedTime& reduced, double deltaTime);
+
         void registerPlugin (std::size_t typeIndex, IInitPlugin& plugin);
         void registerPlugin (std::size_t typeIndex, std::unique_ptr<IPlugin> plugin);
 
@@ -104,9 +121,15 @@ namespace phenyl::core {
             return ptr;
         }
     public:
-        explicit PhenylRuntime ();
+        PhenylRuntime ();
+        // Runtimes running in parallel should use few or no worker threads each, to not oversubscribe the cores
+        explicit PhenylRuntime (std::size_t workerThreads);
         virtual ~PhenylRuntime();
 
+        // Binds the per-runtime state used through static functions (i.e. Assets) to the calling thread until the
+        // returned scope ends. Done by all run*() functions, so only needed when using that state from outside a stage.
+        [[nodiscard]] AssetScope makeCurrent ();
+
         World& world () {
             return runtimeWorld;
         }
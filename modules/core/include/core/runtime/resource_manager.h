@@ -54,5 +54,13 @@ namespace phenyl::core {
         void addResource (T* resource) {
             registerResource(meta::type_index<T>(), resource);
         }
+
+        // Destroys owned resources, newest first as later resources may have been made from earlier ones
+        void clear () {
+            resources.clear();
+            while (!ownedResources.empty()) {
+                ownedResources.pop_back();
+            }
+        }
     };
 }
\ No newline at end of file
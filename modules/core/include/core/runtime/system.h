@@ -8,6 +8,7 @@
 
 #include "forward.h"
 #include "core/resources.h"
+#include "core/stages.h"
 #include "resource_manager.h"
 
 namespace phenyl::core {
@@ -17,6 +18,7 @@ namespace phenyl::core {
     protected:
         std::unordered_set<IRunnableSystem*> parentSystems;
         std::string systemName;
+        bool reducedSteps = false;
     public:
         explicit IRunnableSystem (std::string name) : systemName{std::move(name)} {}
 
@@ -31,6 +33,11 @@ namespace phenyl::core {
             return false;
         }
 
+        // Whether the system also runs in reduced steps, see World::reducedStep()
+        bool runsInReducedSteps () const noexcept {
+            return reducedSteps;
+        }
+
         const std::unordered_set<IRunnableSystem*>& getPrecedingSystems () const {
             return parentSystems;
         }
@@ -53,8 +60,25 @@ namespace phenyl::core {
 
             return *this;
         }
+
+        // Systems over stage queries only see reduced entities in reduced steps, so always run in them. Other systems
+        // must opt in, and should check World::reducedStep() for what they are simulating.
+        System<Stage>& runInReducedSteps () {
+            this->reducedSteps = true;
+
+            return *this;
+        }
     };
 
+    template <typename Stage, typename ...Args>
+    Query<Args...> MakeStageQuery (World& world) {
+        if constexpr (SkipsFrozen<Stage>) {
+            return world.activeQuery<Args...>();
+        } else {
+            return world.query<Args...>();
+        }
+    }
+
     template <typename Stage>
     class FunctionSystem : public System<Stage> {
     private:
@@ -71,6 +95,17 @@ namespace phenyl::core {
         }
     };
 
+    // Stage queries only see reduced entities during reduced steps, so systems over them can run in reduced steps too
+    template <typename Stage>
+    std::unique_ptr<System<Stage>> MakeStageQuerySystem (std::string systemName, std::function<void()> func) {
+        auto system = std::make_unique<FunctionSystem<Stage>>(std::move(systemName), std::move(func));
+        if constexpr (SkipsFrozen<Stage>) {
+            system->runInReducedSteps();
+        }
+
+        return system;
+    }
+
     template <typename Stage, typename T>
     class ExclusiveFunctionSystem : public System<Stage> {
     private:
@@ -89,7 +124,7 @@ namespace phenyl::core {
 
     template <typename Stage, ResourceType ...ResourceTypes, ComponentType ...Components> requires (sizeof...(Components) > 0 && (!std::same_as<std::remove_all_extents_t<Components>, core::Entity> && ... && true))
     std::unique_ptr<System<Stage>> MakeSystem (std::string systemName, void (*func) (const Resources<ResourceTypes...>&, Components&...), World& world, ResourceManager& resManager) {
-        auto query = world.query<std::remove_reference_t<Components>...>();
+        auto query = MakeStageQuery<Stage, std::remove_reference_t<Components>...>(world);
         std::function<void()> func1 = [query = std::move(query), &resManager, func] () {
             Resources<ResourceTypes...> resources{resManager};
 
@@ -98,24 +133,24 @@ namespace phenyl::core {
             });
         };
 
-        return std::make_unique<FunctionSystem<Stage>>(std::move(systemName), std::move(func1));
+        return MakeStageQuerySystem<Stage>(std::move(systemName), std::move(func1));
     }
 
     template <typename Stage, ComponentType ...Components> requires (sizeof...(Components) > 0 && (!std::same_as<std::remove_all_extents_t<Components>, core::Entity> && ... && true))
     std::unique_ptr<System<Stage>> MakeSystem (std::string systemName, void (*func) (Components...), World& world, ResourceManager& resManager) {
-        auto query = world.query<std::remove_reference_t<Components>...>();
+        auto query = MakeStageQuery<Stage, std::remove_reference_t<Components>...>(world);
         std::function<void()> func1 = [query = std::move(query), func] () {
             query.each([&] (Components&... components) {
                 func(components...);
             });
         };
 
-        return std::make_unique<FunctionSystem<Stage>>(std::move(systemName), std::move(func1));
+        return MakeStageQuerySystem<Stage>(std::move(systemName), std::move(func1));
     }
 
     template <typename Stage, ResourceType ...ResourceTypes, ComponentType ...Components> requires (sizeof...(Components) > 0 && (!std::same_as<std::remove_all_extents_t<Components>, core::Entity> && ... && true))
     std::unique_ptr<System<Stage>> MakeSystem (std::string systemName, void (*func) (const Resources<ResourceTypes...>&, const core::Bundle<Components...>& bundle), World& world, ResourceManager& resManager) {
-        auto query = world.query<std::remove_reference_t<Components>...>();
+        auto query = MakeStageQuery<Stage, std::remove_reference_t<Components>...>(world);
         std::function<void()> func1 = [query = std::move(query), func, &resManager] () {
             Resources<ResourceTypes...> resources{resManager};
 
@@ -124,7 +159,7 @@ namespace phenyl::core {
             });
         };
 
-        return std::make_unique<FunctionSystem<Stage>>(std::move(systemName), std::move(func1));
+        return MakeStageQuerySystem<Stage>(std::move(systemName), std::move(func1));
     }
 
     /*template <typename Stage, ComponentType ...Components> requires (sizeof...(Components) > 0 && (!std::same_as<std::remove_all_extents_t<Components>, component::Entity2> && ... && true))
@@ -142,6 +177,7 @@ namespace phenyl::core {
     template <typename Stage, ResourceType ...ResourceTypes, ComponentType ...Components> requires (sizeof...(Components) > 0 && (!std::same_as<std::remove_all_extents_t<Components>, core::Entity> && ... && true))
     std::unique_ptr<System<Stage>> MakeSystem (std::string systemName, void (*func) (const Resources<ResourceTypes...>&, const core::Bundle<Components...>&, const core::Bundle<Components...>&),
         World& world, ResourceManager& resManager) {
+        // Frozen entities are still pair partners of active ones, so pair systems see all entities
         auto query = world.query<std::remove_reference_t<Components>...>();
         std::function<void()> func1 = [query = std::move(query), func, &resManager] () {
             Resources<ResourceTypes...> resources{resManager};
@@ -159,6 +195,7 @@ namespace phenyl::core {
         World& world, ResourceManager& resManager) {
         //return std::make_unique<ComponentDoubleSystem<Resources..., Components...>>(func);
 
+        // Frozen entities are still pair partners of active ones, so pair systems see all entities
         auto query = world.query<std::remove_reference_t<Components>...>();
         std::function<void()> func1 = [query = std::move(query), func] () {
             query.pairs([&] (const core::Bundle<Components...>& bundle1, const core::Bundle<Components...>& bundle2) {
@@ -171,7 +208,7 @@ namespace phenyl::core {
 
     template <typename Stage, ComponentType T, ResourceType ...ResourceTypes, ComponentType ...Components>
     std::unique_ptr<System<Stage>> MakeSystem (std::string systemName, void (T::*func) (const Resources<ResourceTypes...>& resources, Components...), World& world, ResourceManager& resManager) {
-        core::Query<T, std::remove_reference_t<Components>...> query = world.query<T, std::remove_reference_t<Components>...>();
+        core::Query<T, std::remove_reference_t<Components>...> query = MakeStageQuery<Stage, T, std::remove_reference_t<Components>...>(world);
         std::function<void()> func1 = [query = std::move(query), func, &resManager] () {
             Resources<ResourceTypes...> resources{resManager};
 
@@ -180,24 +217,24 @@ namespace phenyl::core {
             });
         };
 
-        return std::make_unique<FunctionSystem<Stage>>(std::move(systemName), std::move(func1));
+        return MakeStageQuerySystem<Stage>(std::move(systemName), std::move(func1));
     }
 
     template <typename Stage, ComponentType T, ComponentType ...Components>
     std::unique_ptr<System<Stage>> MakeSystem (std::string systemName, void (T::*func) (Components...), World& world, ResourceManager& resManager) {
-        auto query = world.query<T, std::remove_reference_t<Components>...>();
+        auto query = MakeStageQuery<Stage, T, std::remove_reference_t<Components>...>(world);
         std::function<void()> func1 = [query = std::move(query), func] () {
             query.each([&] (T& obj, Components&... components) {
                 (obj.*func)(components...);
             });
         };
 
-        return std::make_unique<FunctionSystem<Stage>>(std::move(systemName), std::move(func1));
+        return MakeStageQuerySystem<Stage>(std::move(systemName), std::move(func1));
     }
 
     template <typename Stage, ComponentType T, ResourceType ...ResourceTypes, ComponentType ...Components>
     std::unique_ptr<System<Stage>> MakeSystem (std::string systemName, void (T::*func) (const Resources<ResourceTypes...>& resources, const phenyl::core::Bundle<Components...>& bundle), World& world, ResourceManager& resManager) {
-        auto query = world.query<T, std::remove_reference_t<Components>...>();
+        auto query = MakeStageQuery<Stage, T, std::remove_reference_t<Components>...>(world);
         std::function<void()>func1 = [query = std::move(query), func, &resManager] () {
             Resources<ResourceTypes...> resources{resManager};
 
@@ -207,12 +244,12 @@ namespace phenyl::core {
             });
         };
 
-        return std::make_unique<FunctionSystem<Stage>>(std::move(systemName), std::move(func1));
+        return MakeStageQuerySystem<Stage>(std::move(systemName), std::move(func1));
     }
 
     template <typename Stage, ComponentType T, ComponentType ...Components>
     std::unique_ptr<System<Stage>> MakeSystem (std::string systemName, void (T::*func) (const phenyl::core::Bundle<Components...>& bundle), World& world, ResourceManager& resManager) {
-        auto query = world.query<T, std::remove_reference_t<Components>...>();
+        auto query = MakeStageQuery<Stage, T, std::remove_reference_t<Components>...>(world);
         std::function<void()> func1 = [query = std::move(query), func] () {
             query.each([&] (const phenyl::core::Bundle<T, Components...>& bundle) {
                 T& obj = bundle.template get<T>();
@@ -220,7 +257,7 @@ namespace phenyl::core {
             });
         };
 
-        return std::make_unique<FunctionSystem<Stage>>(std::move(systemName), std::move(func1));
+        return MakeStageQuerySystem<Stage>(std::move(systemName), std::move(func1));
     }
 
     template <typename Stage, ResourceType ...ResourceTypes>
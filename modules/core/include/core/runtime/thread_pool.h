@@ -0,0 +1,56 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "core/iresource.h"
+
+namespace phenyl::core {
+    class ThreadPool : public IResource {
+    private:
+        std::vector<std::thread> workers;
+
+        std::mutex mutex;
+        std::condition_variable workCondition;
+        std::condition_variable doneCondition;
+
+        const std::function<void(std::size_t, std::size_t)>* currentJob = nullptr;
+        std::size_t jobSize = 0;
+        std::size_t numChunks = 0;
+        std::atomic<std::size_t> nextChunk = 0;
+        std::size_t chunksDone = 0;
+        std::size_t activeWorkers = 0;
+
+        std::uint64_t generation = 0;
+        bool stopping = false;
+
+        void workerLoop ();
+        void runChunks ();
+    public:
+        static std::size_t DefaultThreads ();
+
+        explicit ThreadPool (std::size_t numThreads = DefaultThreads());
+        ~ThreadPool () override;
+
+        ThreadPool (const ThreadPool&) = delete;
+        ThreadPool& operator= (const ThreadPool&) = delete;
+
+        // Number of threads that can run work, including the calling thread
+        [[nodiscard]] std::size_t size () const noexcept {
+            return workers.size() + 1;
+        }
+
+        // Splits [0, count) into contiguous ranges of at least minChunk elements and blocks until fn has been run on all
+        // of them. The calling thread takes part in the work.
+        void parallelFor (std::size_t count, std::size_t minChunk, const std::function<void(std::size_t, std::size_t)>& fn);
+
+        [[nodiscard]] std::string_view getName () const noexcept override {
+            return "ThreadPool";
+        }
+    };
+}
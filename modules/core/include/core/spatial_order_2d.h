@@ -0,0 +1,57 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "core/iresource.h"
+#include "core/world.h"
+#include "core/components/2d/global_transform.h"
+
+namespace phenyl::core {
+    // Periodically reorders the rows of selected archetypes along a Morton (Z-order) curve of their GlobalTransform2D
+    // positions, so that entities close in space are also close in memory. The work is spread over several frames,
+    // with at most rowsPerFrame rows placed each frame.
+    //
+    // Rows are only moved between frames, so component pointers must not be held across frames anyway.
+    class SpatialOrder2D : public IResource {
+    private:
+        struct Plan {
+            Archetype* archetype = nullptr;
+            // Target order of entities, built once when the archetype is reached in a cycle
+            std::vector<EntityId> order;
+            std::size_t cursor = 0;
+            std::size_t nextRow = 0;
+        };
+
+        World& world;
+        std::vector<std::shared_ptr<QueryArchetypes>> selected;
+
+        std::vector<Archetype*> pending;
+        Plan current;
+        std::size_t framesSinceCycle = 0;
+
+        void startCycle ();
+        void buildPlan (Archetype& archetype);
+        std::size_t applyPlan (std::size_t budget);
+    public:
+        bool enabled = true;
+        // Maximum number of rows placed each frame
+        std::size_t rowsPerFrame = 1024;
+        // Frames between the end of one reordering cycle and the start of the next
+        std::size_t cycleFrames = 120;
+
+        explicit SpatialOrder2D (World& world);
+
+        // Selects archetypes with a GlobalTransform2D and all of Args for reordering
+        template <typename ...Args>
+        void select () {
+            selected.emplace_back(world.makeQueryArchetypes(detail::ArchetypeKey::Make<GlobalTransform2D, Args...>()));
+        }
+
+        void reorder ();
+
+        [[nodiscard]] std::string_view getName () const noexcept override {
+            return "SpatialOrder2D";
+        }
+    };
+}
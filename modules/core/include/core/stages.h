@@ -10,4 +10,15 @@ namespace phenyl::core {
     struct Render {};
     struct FixedUpdate {};
     struct PhysicsUpdate {};
+
+    // Systems of simulation stages only see active entities, see Frozen
+    template <typename S>
+    inline constexpr bool SkipsFrozen = false;
+
+    template <>
+    inline constexpr bool SkipsFrozen<Update> = true;
+    template <>
+    inline constexpr bool SkipsFrozen<FixedUpdate> = true;
+    template <>
+    inline constexpr bool SkipsFrozen<PhysicsUpdate> = true;
 }
\ No newline at end of file
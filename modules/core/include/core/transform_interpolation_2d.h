@@ -0,0 +1,50 @@
+#pragma once
+
+#include "core/iresource.h"
+#include "core/world.h"
+#include "core/components/2d/global_transform.h"
+#include "core/serialization/serializer_forward.h"
+
+namespace phenyl::core {
+    // Marks an entity whose GlobalTransform2D is rendered interpolated between the last two fixed timesteps, for
+    // entities moved by the fixed timestep (e.g. physics bodies) when the fixed rate is below the frame rate
+    struct Interpolated2D {
+    private:
+        Transform2D previous;
+        Transform2D current;
+        bool hasPrevious = false;
+
+        friend class TransformInterpolation2D;
+    public:
+        // Renders the entity at its actual transform until the next fixed timestep, e.g. after teleporting it
+        void reset () noexcept {
+            hasPrevious = false;
+        }
+    };
+
+    PHENYL_DECLARE_SERIALIZABLE(Interpolated2D)
+
+    // Driven by the engine's game loop: the state before every fixed timestep is snapshotted, and during rendering the
+    // GlobalTransform2D of interpolated entities is blended from that snapshot to the actual state. The actual state is
+    // restored once rendering is done, so all other stages only see simulated transforms.
+    class TransformInterpolation2D : public IResource {
+    private:
+        Query<GlobalTransform2D, Interpolated2D> query;
+        bool applied = false;
+    public:
+        bool enabled = true;
+
+        explicit TransformInterpolation2D (World& world);
+
+        // Called before every fixed timestep
+        void snapshot ();
+        // Called before rendering, with the fraction of a fixed timestep simulated past the snapshot
+        void apply (double alpha);
+        // Called after rendering
+        void restore ();
+
+        [[nodiscard]] std::string_view getName () const noexcept override {
+            return "TransformInterpolation2D";
+        }
+    };
+}
@@ -50,6 +50,7 @@ namespace phenyl::core {
         std::vector<std::weak_ptr<QueryArchetypes>> queryArchetypes;
 
         std::unordered_map<std::size_t, std::unique_ptr<detail::IHandlerVector>> signalHandlerVectors;
+        std::vector<std::function<void(EntityId)>> removeHandlers;
 
         std::shared_ptr<PrefabManager> prefabManager;
 
@@ -61,10 +62,13 @@ namespace phenyl::core {
         std::uint32_t removeDeferCount = 0;
         std::uint32_t signalDeferCount = 0;
 
+        std::uint64_t reducedStepInterval = 1;
+        bool inReducedStep = false;
+
         void completeCreation (EntityId id, EntityId parent);
         void removeInt (EntityId id, bool updateParent);
 
-        std::shared_ptr<QueryArchetypes> makeQueryArchetypes (detail::ArchetypeKey key);
+        std::shared_ptr<QueryArchetypes> makeQueryArchetypes (detail::ArchetypeKey key, bool skipFrozen = false, std::size_t excludedType = 0);
         void cleanupQueryArchetypes ();
 
         Archetype* findArchetype (const detail::ArchetypeKey& key) override;
@@ -87,6 +91,7 @@ namespace phenyl::core {
         friend Entity;
         friend ChildrenView;
         friend PrefabManager;
+        friend class SpatialOrder2D;
     public:
         using iterator = EntityIterator;
 
@@ -130,6 +135,18 @@ namespace phenyl::core {
             return Query<Args...>{makeQueryArchetypes(detail::ArchetypeKey::Make<Args...>()), this};
         }
 
+        // Same as query(), but skips entities with the Frozen component
+        template <typename ...Args>
+        Query<Args...> activeQuery () {
+            return Query<Args...>{makeQueryArchetypes(detail::ArchetypeKey::Make<Args...>(), true), this};
+        }
+
+        // Same as query(), but skips entities with the Excluded component
+        template <typename Excluded, typename ...Args>
+        Query<Args...> queryWithout () {
+            return Query<Args...>{makeQueryArchetypes(detail::ArchetypeKey::Make<Args...>(), false, meta::type_index<std::remove_cvref_t<Excluded>>()), this};
+        }
+
         template <typename T>
         void addHandler (std::function<void(const OnInsert<T>&, Entity)> handler) {
             auto it = components.find(meta::type_index<T>());
@@ -180,6 +197,32 @@ namespace phenyl::core {
             addHandler<Signal, Args...>(std::function<void(const Signal&, std::remove_reference_t<Args>&...)>{std::forward<decltype(fn)>(fn)});
         }
 
+        // Called with the id of every entity about to be removed, including children removed with their parent and
+        // entities removed by clear(). Removed entities do not raise OnRemove for their components.
+        void addRemoveHandler (std::function<void(EntityId)> handler) {
+            removeHandlers.emplace_back(std::move(handler));
+        }
+
+        // Entities with the Reduced component skip the steps of the simulation stages, and are simulated in reduced steps
+        // of their own every interval steps, over the time they skipped. Active queries only see reduced entities during
+        // a reduced step.
+        void setReducedInterval (std::uint64_t interval) noexcept {
+            reducedStepInterval = std::max(interval, std::uint64_t{1});
+        }
+
+        [[nodiscard]] std::uint64_t reducedInterval () const noexcept {
+            return reducedStepInterval;
+        }
+
+        [[nodiscard]] bool reducedStep () const noexcept {
+            return inReducedStep;
+        }
+
+        // Whether any entity has the Reduced component
+        [[nodiscard]] bool hasReduced () const noexcept;
+        void beginReducedStep ();
+        void endReducedStep ();
+
         void defer ();
         void deferEnd ();
         void deferSignals ();
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "core/iresource.h"
+#include "core/world.h"
+#include "core/components/frozen.h"
+#include "core/components/2d/global_transform.h"
+#include "core/serialization/serializer_forward.h"
+
+namespace phenyl::core {
+    // Marks an entity whose position is a focus point of the world partition, e.g. the player
+    struct PartitionFocus2D {};
+
+    PHENYL_DECLARE_SERIALIZABLE(PartitionFocus2D)
+
+    enum class CellActivity2D {
+        ACTIVE,
+        REDUCED,
+        FROZEN
+    };
+
+    // Assigns entities with a GlobalTransform2D to square cells, and sets the activity of each cell from its distance
+    // (in cells) to the nearest focus point:
+    //  - ACTIVE cells, within activeRadius, are simulated every step
+    //  - REDUCED cells, within reducedRadius, are only simulated every reducedInterval steps, over the time skipped
+    //  - FROZEN cells, further away, are not simulated at all
+    //
+    // Entities outside of active cells have the Frozen component, so are skipped by systems of the simulation stages
+    // and by physics. Entities in reduced cells also have Reduced, so are simulated in the runtime's reduced steps, see
+    // World::reducedStep(). Components are only changed when the activity of an entity's cell changes, and entities
+    // wake as soon as their cell becomes active again. Reduced steps are shared by all reduced cells, so an entity
+    // changing between active and reduced cells may gain or lose up to reducedInterval - 1 steps.
+    class WorldPartition2D : public IResource {
+    private:
+        World& world;
+        Query<GlobalTransform2D, PartitionFocus2D> focusQuery;
+        Query<GlobalTransform2D> activeQuery;
+        Query<GlobalTransform2D, Reduced> reducedQuery;
+        Query<GlobalTransform2D, Frozen> frozenQuery;
+
+        std::vector<glm::ivec2> focusCells;
+        // Activity of each cell with entities in it on the current frame
+        std::unordered_map<std::uint64_t, CellActivity2D> cellActivities;
+
+        [[nodiscard]] glm::ivec2 cellOf (glm::vec2 pos) const;
+        [[nodiscard]] CellActivity2D cellActivity (glm::ivec2 cell) const;
+        CellActivity2D cachedActivity (glm::vec2 pos);
+    public:
+        bool enabled = true;
+        float cellSize = 4.0f;
+        std::int32_t activeRadius = 2;
+        std::int32_t reducedRadius = 4;
+        std::uint64_t reducedInterval = 4;
+        // Extra focus points, e.g. the camera position, in addition to PartitionFocus2D entities
+        std::vector<glm::vec2> focusPoints;
+
+        explicit WorldPartition2D (World& world);
+
+        [[nodiscard]] CellActivity2D activity (glm::vec2 pos) const;
+
+        void update ();
+
+        [[nodiscard]] std::string_view getName () const noexcept override {
+            return "WorldPartition2D";
+        }
+    };
+}
@@ -4,7 +4,7 @@
 
 using namespace phenyl::core;
 
-Assets* Assets::INSTANCE = nullptr;
+thread_local Assets* Assets::CURRENT = nullptr;
 
 bool detail::AssetManagerBase::OnUnloadUntyped (std::size_t typeIndex, std::size_t id) {
     return Assets::UnloadAsset(typeIndex, id);
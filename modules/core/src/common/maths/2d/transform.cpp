@@ -76,4 +76,12 @@ Transform2D& Transform2D::setRotation (float angle) {
 
 Transform2D Transform2D::withRotation (float angle) {
     return Transform2D{positionVec, scaleVec, rotationFromAngle(angle)};
-}
\ No newline at end of file
+}
+
+Transform2D Transform2D::Interpolate (const Transform2D& from, const Transform2D& to, float t) {
+    auto rot = glm::mix(from.complexRotation, to.complexRotation, t);
+    auto rotLength = glm::length(rot);
+
+    // Opposite rotations blend through zero, so snap to the target instead
+    return Transform2D{glm::mix(from.positionVec, to.positionVec, t), glm::mix(from.scaleVec, to.scaleVec, t), rotLength > 1e-6f ? rot / rotLength : to.complexRotation};
+}
@@ -0,0 +1,19 @@
+#include "core/runtime.h"
+
+#include "core/spatial_order_2d.h"
+#include "core/plugins/core_plugin_2d.h"
+#include "core/plugins/spatial_order_plugin_2d.h"
+
+using namespace phenyl::core;
+
+std::string_view SpatialOrder2DPlugin::getName () const noexcept {
+    return "SpatialOrder2DPlugin";
+}
+
+void SpatialOrder2DPlugin::init (PhenylRuntime& runtime) {
+    runtime.addPlugin<Core2DPlugin>();
+
+    runtime.addResource<SpatialOrder2D>(runtime.world());
+    // Runs before any fixed or variable update so that no system holds component pointers while rows move
+    runtime.addSystem<FrameBegin>("SpatialOrder2D::Reorder", &runtime.resource<SpatialOrder2D>(), &SpatialOrder2D::reorder);
+}
@@ -0,0 +1,18 @@
+#include "core/runtime.h"
+
+#include "core/transform_interpolation_2d.h"
+#include "core/plugins/core_plugin_2d.h"
+#include "core/plugins/transform_interpolation_plugin_2d.h"
+
+using namespace phenyl::core;
+
+std::string_view TransformInterpolation2DPlugin::getName () const noexcept {
+    return "TransformInterpolation2DPlugin";
+}
+
+void TransformInterpolation2DPlugin::init (PhenylRuntime& runtime) {
+    runtime.addPlugin<Core2DPlugin>();
+
+    runtime.addComponent<Interpolated2D>("Interpolated2D");
+    runtime.addResource<TransformInterpolation2D>(runtime.world());
+}
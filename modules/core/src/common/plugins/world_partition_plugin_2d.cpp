@@ -0,0 +1,20 @@
+#include "core/runtime.h"
+
+#include "core/world_partition_2d.h"
+#include "core/plugins/core_plugin_2d.h"
+#include "core/plugins/world_partition_plugin_2d.h"
+
+using namespace phenyl::core;
+
+std::string_view WorldPartition2DPlugin::getName () const noexcept {
+    return "WorldPartition2DPlugin";
+}
+
+void WorldPartition2DPlugin::init (PhenylRuntime& runtime) {
+    runtime.addPlugin<Core2DPlugin>();
+
+    runtime.addComponent<PartitionFocus2D>("PartitionFocus2D");
+    runtime.addResource<WorldPartition2D>(runtime.world());
+    // Entities change archetype when frozen or woken, so this must run before any system holds component pointers
+    runtime.addSystem<FrameBegin>("WorldPartition2D::Update", &runtime.resource<WorldPartition2D>(), &WorldPartition2D::update);
+}
@@ -0,0 +1,142 @@
+#include <algorithm>
+#include <limits>
+
+#include "core/spatial_order_2d.h"
+#include "util/profiler.h"
+
+using namespace phenyl::core;
+
+// Spreads the low 16 bits of x so that there is a zero bit between each of them
+static std::uint32_t SpreadBits (std::uint32_t x) {
+    x &= 0x0000FFFF;
+    x = (x | (x << 8)) & 0x00FF00FF;
+    x = (x | (x << 4)) & 0x0F0F0F0F;
+    x = (x | (x << 2)) & 0x33333333;
+    x = (x | (x << 1)) & 0x55555555;
+
+    return x;
+}
+
+static std::uint32_t MortonKey (glm::vec2 pos, glm::vec2 min, glm::vec2 invExtent) {
+    auto normalised = glm::clamp((pos - min) * invExtent, glm::vec2{0.0f, 0.0f}, glm::vec2{1.0f, 1.0f});
+    auto x = static_cast<std::uint32_t>(normalised.x * 65535.0f);
+    auto y = static_cast<std::uint32_t>(normalised.y * 65535.0f);
+
+    return SpreadBits(x) | (SpreadBits(y) << 1);
+}
+
+SpatialOrder2D::SpatialOrder2D (World& world) : world{world} {}
+
+void SpatialOrder2D::reorder () {
+    if (!enabled) {
+        return;
+    }
+
+    if (!current.archetype && pending.empty()) {
+        util::setProfileCounter("core.spatial_order_rows", 0.0);
+        if (++framesSinceCycle < cycleFrames) {
+            return;
+        }
+
+        startCycle();
+    }
+
+    std::size_t budget = rowsPerFrame;
+    std::size_t rows = 0;
+    while (budget) {
+        if (!current.archetype) {
+            if (pending.empty()) {
+                break;
+            }
+
+            // Building a plan sorts the whole archetype, so only do one per frame
+            buildPlan(*pending.back());
+            pending.pop_back();
+            break;
+        }
+
+        auto placed = applyPlan(budget);
+        budget -= placed;
+        rows += placed;
+    }
+
+    util::setProfileCounter("core.spatial_order_rows", static_cast<double>(rows));
+}
+
+void SpatialOrder2D::startCycle () {
+    framesSinceCycle = 0;
+
+    pending.clear();
+    for (const auto& query : selected) {
+        for (auto& archetype : *query) {
+            // Archetypes may be matched by several selections
+            if (archetype.size() > 1 && std::ranges::find(pending, &archetype) == pending.end()) {
+                pending.emplace_back(&archetype);
+            }
+        }
+    }
+}
+
+void SpatialOrder2D::buildPlan (Archetype& archetype) {
+    current.archetype = &archetype;
+    current.order.clear();
+    current.cursor = 0;
+    current.nextRow = 0;
+
+    if (!archetype.size()) {
+        return;
+    }
+
+    glm::vec2 min{std::numeric_limits<float>::max()};
+    glm::vec2 max{-std::numeric_limits<float>::max()};
+    for (std::size_t i = 0; i < archetype.size(); i++) {
+        auto pos = archetype.get<GlobalTransform2D>(i).transform2D.position();
+        min = glm::min(min, pos);
+        max = glm::max(max, pos);
+    }
+
+    auto extent = max - min;
+    glm::vec2 invExtent{extent.x > 0 ? 1.0f / extent.x : 0.0f, extent.y > 0 ? 1.0f / extent.y : 0.0f};
+
+    std::vector<std::pair<std::uint32_t, std::size_t>> keys;
+    keys.reserve(archetype.size());
+    for (std::size_t i = 0; i < archetype.size(); i++) {
+        keys.emplace_back(MortonKey(archetype.get<GlobalTransform2D>(i).transform2D.position(), min, invExtent), i);
+    }
+    std::ranges::sort(keys);
+
+    current.order.reserve(keys.size());
+    for (auto [_, row] : keys) {
+        current.order.emplace_back(archetype.getEntityId(row));
+    }
+}
+
+std::size_t SpatialOrder2D::applyPlan (std::size_t budget) {
+    auto& archetype = *current.archetype;
+
+    // Entities may have been created, removed or moved to other archetypes since the plan was built. Those are
+    // skipped, and new entities are left at the end until the next cycle.
+    std::size_t placed = 0;
+    while (placed < budget && current.cursor < current.order.size() && current.nextRow < archetype.size()) {
+        auto id = current.order[current.cursor++];
+        placed++;
+
+        if (!world.exists(id)) {
+            continue;
+        }
+
+        const auto& entry = world.entityEntries[id.pos()];
+        if (entry.archetype != &archetype) {
+            continue;
+        }
+
+        archetype.swapRows(entry.pos, current.nextRow++);
+    }
+
+    if (current.cursor >= current.order.size() || current.nextRow >= archetype.size()) {
+        current.archetype = nullptr;
+        current.order.clear();
+    }
+
+    return placed;
+}
@@ -0,0 +1,48 @@
+#include "core/serialization/serializer_impl.h"
+
+#include "core/transform_interpolation_2d.h"
+
+namespace phenyl::core {
+    PHENYL_SERIALIZABLE(Interpolated2D)
+}
+
+using namespace phenyl::core;
+
+TransformInterpolation2D::TransformInterpolation2D (World& world) : query{world.query<GlobalTransform2D, Interpolated2D>()} {}
+
+void TransformInterpolation2D::snapshot () {
+    PHENYL_DASSERT_MSG(!applied, "Attempted to snapshot interpolated transforms while they are applied");
+
+    query.each([] (const GlobalTransform2D& transform, Interpolated2D& interp) {
+        interp.previous = transform.transform2D;
+        interp.hasPrevious = true;
+    });
+}
+
+void TransformInterpolation2D::apply (double alpha) {
+    if (!enabled || applied) {
+        return;
+    }
+
+    auto t = static_cast<float>(glm::clamp(alpha, 0.0, 1.0));
+    query.each([t] (GlobalTransform2D& transform, Interpolated2D& interp) {
+        interp.current = transform.transform2D;
+        if (interp.hasPrevious) {
+            transform.transform2D = Transform2D::Interpolate(interp.previous, interp.current, t);
+        }
+    });
+    applied = true;
+}
+
+void TransformInterpolation2D::restore () {
+    if (!applied) {
+        return;
+    }
+
+    query.each([] (GlobalTransform2D& transform, const Interpolated2D& interp) {
+        if (interp.hasPrevious) {
+            transform.transform2D = interp.current;
+        }
+    });
+    applied = false;
+}
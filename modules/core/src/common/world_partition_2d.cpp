@@ -0,0 +1,132 @@
+#include <limits>
+
+#include "core/serialization/serializer_impl.h"
+
+#include "core/world_partition_2d.h"
+#include "util/profiler.h"
+
+namespace phenyl::core {
+    PHENYL_SERIALIZABLE(PartitionFocus2D)
+}
+
+using namespace phenyl::core;
+
+static std::uint64_t CellKey (glm::ivec2 cell) {
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(cell.x)) << 32) | static_cast<std::uint32_t>(cell.y);
+}
+
+static std::int32_t CellDistance (glm::ivec2 cell1, glm::ivec2 cell2) {
+    return glm::max(glm::abs(cell1.x - cell2.x), glm::abs(cell1.y - cell2.y));
+}
+
+WorldPartition2D::WorldPartition2D (World& world) : world{world}, focusQuery{world.query<GlobalTransform2D, PartitionFocus2D>()},
+    activeQuery{world.activeQuery<GlobalTransform2D>()}, reducedQuery{world.query<GlobalTransform2D, Reduced>()},
+    frozenQuery{world.queryWithout<Reduced, GlobalTransform2D, Frozen>()} {}
+
+glm::ivec2 WorldPartition2D::cellOf (glm::vec2 pos) const {
+    return glm::ivec2{glm::floor(pos / cellSize)};
+}
+
+CellActivity2D WorldPartition2D::activity (glm::vec2 pos) const {
+    return cellActivity(cellOf(pos));
+}
+
+CellActivity2D WorldPartition2D::cellActivity (glm::ivec2 cell) const {
+    auto distance = std::numeric_limits<std::int32_t>::max();
+    for (auto focus : focusCells) {
+        distance = glm::min(distance, CellDistance(cell, focus));
+    }
+
+    if (distance <= activeRadius) {
+        return CellActivity2D::ACTIVE;
+    } else if (distance <= reducedRadius) {
+        return CellActivity2D::REDUCED;
+    } else {
+        return CellActivity2D::FROZEN;
+    }
+}
+
+CellActivity2D WorldPartition2D::cachedActivity (glm::vec2 pos) {
+    auto cell = cellOf(pos);
+    auto key = CellKey(cell);
+    if (auto it = cellActivities.find(key); it != cellActivities.end()) {
+        return it->second;
+    }
+
+    auto activity = cellActivity(cell);
+    cellActivities.emplace(key, activity);
+    return activity;
+}
+
+void WorldPartition2D::update () {
+    PHENYL_DASSERT_MSG(cellSize > 0, "World partition cell size must be positive");
+    if (!enabled) {
+        return;
+    }
+
+    world.setReducedInterval(reducedInterval);
+    cellActivities.clear();
+
+    focusCells.clear();
+    focusQuery.each([&] (const GlobalTransform2D& transform, const PartitionFocus2D&) {
+        focusCells.emplace_back(cellOf(transform.transform2D.position()));
+    });
+    for (auto point : focusPoints) {
+        focusCells.emplace_back(cellOf(point));
+    }
+
+    // Changes are deferred until all entities have been checked, so each is only moved once
+    world.defer();
+
+    std::size_t frozen = 0;
+    std::size_t woken = 0;
+    // Without a focus everything stays active
+    auto hasFocus = !focusCells.empty();
+    if (hasFocus) {
+        activeQuery.each([&] (const Bundle<GlobalTransform2D>& bundle) {
+            auto activity = cachedActivity(bundle.get<GlobalTransform2D>().transform2D.position());
+            if (activity == CellActivity2D::ACTIVE) {
+                return;
+            }
+
+            if (activity == CellActivity2D::REDUCED) {
+                bundle.entity().insert(Reduced{});
+            }
+            bundle.entity().insert(Frozen{});
+            frozen++;
+        });
+    }
+
+    reducedQuery.each([&] (const Bundle<GlobalTransform2D, Reduced>& bundle) {
+        auto activity = hasFocus ? cachedActivity(bundle.get<GlobalTransform2D>().transform2D.position()) : CellActivity2D::ACTIVE;
+        if (activity == CellActivity2D::REDUCED) {
+            return;
+        }
+
+        bundle.entity().erase<Reduced>();
+        if (activity == CellActivity2D::ACTIVE) {
+            bundle.entity().erase<Frozen>();
+            woken++;
+        }
+    });
+
+    frozenQuery.each([&] (const Bundle<GlobalTransform2D, Frozen>& bundle) {
+        auto activity = hasFocus ? cachedActivity(bundle.get<GlobalTransform2D>().transform2D.position()) : CellActivity2D::ACTIVE;
+        if (activity == CellActivity2D::FROZEN) {
+            return;
+        }
+
+        if (activity == CellActivity2D::REDUCED) {
+            bundle.entity().insert(Reduced{});
+        } else {
+            bundle.entity().erase<Frozen>();
+            woken++;
+        }
+    });
+
+    world.deferEnd();
+
+    util::setProfileCounter("core.partition_cells", static_cast<double>(cellActivities.size()));
+    util::setProfileCounter("core.partition_frozen", static_cast<double>(frozen));
+    util::setProfileCounter("core.partition_woken", static_cast<double>(woken));
+}
@@ -29,6 +29,21 @@ void Archetype::remove (std::size_t pos) {
     entityIds.pop_back();
 }
 
+void Archetype::swapRows (std::size_t pos1, std::size_t pos2) {
+    PHENYL_DASSERT(pos1 < size() && pos2 < size());
+    if (pos1 == pos2) {
+        return;
+    }
+
+    for (auto& [_, vec] : components) {
+        vec->swap(pos1, pos2);
+    }
+
+    std::swap(entityIds[pos1], entityIds[pos2]);
+    manager.updateEntityEntry(entityIds[pos1], this, pos1);
+    manager.updateEntityEntry(entityIds[pos2], this, pos2);
+}
+
 void Archetype::clear() {
     for (auto& [_, vec] : components) {
         vec->clear();
@@ -1,4 +1,5 @@
 #include "core/world.h"
+#include "core/components/frozen.h"
 #include "core/signals/children_update.h"
 #include "core/detail/loggers.h"
 
@@ -10,6 +11,9 @@ World::World (std::size_t capacity) : idList{capacity}, relationships{capacity},
     auto empty = std::make_unique<EmptyArchetype>(static_cast<detail::IArchetypeManager&>(*this));
     emptyArchetype = empty.get();
     archetypes.emplace_back(std::move(empty));
+
+    addComponent<Frozen>("Frozen");
+    addComponent<Reduced>("Reduced");
 }
 
 World::~World() = default;
@@ -61,6 +65,14 @@ void World::clear() {
     PHENYL_ASSERT(!deferCount);
     PHENYL_ASSERT(!removeDeferCount);
 
+    if (!removeHandlers.empty()) {
+        for (auto id : idList) {
+            for (const auto& handler : removeHandlers) {
+                handler(id);
+            }
+        }
+    }
+
     for (const auto& i : archetypes) {
         i->clear();
     }
@@ -86,6 +98,22 @@ Entity World::parent (EntityId id) noexcept {
     return Entity{parentId, this};
 }
 
+bool World::hasReduced () const noexcept {
+    return std::ranges::any_of(archetypes, [] (const auto& archetype) {
+        return archetype->template has<Reduced>() && archetype->size();
+    });
+}
+
+void World::beginReducedStep () {
+    PHENYL_ASSERT_MSG(!inReducedStep, "Attempted to begin reduced step twice");
+    inReducedStep = true;
+}
+
+void World::endReducedStep () {
+    PHENYL_ASSERT_MSG(inReducedStep, "Attempted to end reduced step without beginning one");
+    inReducedStep = false;
+}
+
 void World::defer () {
     if (deferCount++) {
         // Already deferred
@@ -212,6 +240,10 @@ void World::removeInt (EntityId id, bool updateParent) {
 
     relationships.remove(id, updateParent);
 
+    for (const auto& handler : removeHandlers) {
+        handler(id);
+    }
+
     // Clear entry
     PHENYL_DASSERT(id.pos() < entityEntries.size());
     auto& entry = entityEntries[id.pos()];
@@ -316,16 +348,21 @@ void World::raiseSignal (EntityId id, std::size_t signalType, std::byte* ptr) {
     deferRemoveEnd();
 }
 
-std::shared_ptr<QueryArchetypes> World::makeQueryArchetypes (detail::ArchetypeKey key) {
+std::shared_ptr<QueryArchetypes> World::makeQueryArchetypes (detail::ArchetypeKey key, bool skipFrozen, std::size_t excludedType) {
     cleanupQueryArchetypes();
 
     for (const auto& weakArch : queryArchetypes) {
-        if (auto ptr = weakArch.lock(); ptr->getKey() == key) {
+        if (auto ptr = weakArch.lock(); ptr->getKey() == key && ptr->skipsFrozen() == skipFrozen && ptr->getExcludedType() == excludedType) {
             return ptr;
         }
     }
 
-    auto newArch = std::make_shared<QueryArchetypes>(*this, std::move(key));
+    auto newArch = std::make_shared<QueryArchetypes>(*this, std::move(key), skipFrozen, excludedType);
+    // Pick up archetypes created before this query
+    for (const auto& archetype : archetypes) {
+        newArch->onNewArchetype(archetype.get());
+    }
+
     queryArchetypes.emplace_back(newArch);
     return newArch;
 }
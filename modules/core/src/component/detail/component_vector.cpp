@@ -54,6 +54,11 @@ void UntypedComponentVector::remove (std::size_t pos) {
     vecLength--;
 }
 
+void UntypedComponentVector::swap (std::size_t pos1, std::size_t pos2) {
+    PHENYL_DASSERT(pos1 < size() && pos2 < size());
+    swapComps(getUntyped(pos1), getUntyped(pos2));
+}
+
 void UntypedComponentVector::clear() {
     deleteAllComps(memory.get(), memory.get() + vecLength * compSize);
     vecLength = 0;
@@ -1,18 +1,34 @@
 #include "core/component/query.h"
 
 #include "core/world.h"
+#include "core/components/frozen.h"
 
 using namespace phenyl::core;
 
-QueryArchetypes::QueryArchetypes (World& world, detail::ArchetypeKey key) : world{world}, key{std::move(key)} {}
+QueryArchetypes::QueryArchetypes (World& world, detail::ArchetypeKey key, bool skipFrozen, std::size_t excludedType) : world{world}, key{std::move(key)}, skipFrozen{skipFrozen},
+    excludedType{excludedType} {}
 
 void QueryArchetypes::onNewArchetype (Archetype* archetype) {
-    if (archetype->getKey().subsetOf(key)) {
-        // All components found
+    if (excludedType && archetype->hasUntyped(excludedType)) {
+        return;
+    }
+
+    if (!archetype->getKey().subsetOf(key)) {
+        return;
+    }
+
+    // All components found
+    if (!skipFrozen || !archetype->has<Frozen>()) {
         archetypes.emplace(archetype);
+    } else if (archetype->has<Reduced>()) {
+        reducedArchetypes.emplace(archetype);
     }
 }
 
+const std::unordered_set<Archetype*>& QueryArchetypes::current () const noexcept {
+    return skipFrozen && world.reducedStep() ? reducedArchetypes : archetypes;
+}
+
 void QueryArchetypes::lock() {
     world.defer();
 }
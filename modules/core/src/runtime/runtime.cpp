@@ -1,4 +1,5 @@
 #include "logging/logging.h"
+#include "core/assets/assets.h"
 #include "util/random.h"
 
 #include "core/iresource.h"
@@ -7,6 +8,7 @@
 #include "core/stages.h"
 
 #include "core/delta_time.h"
+#include "core/runtime/thread_pool.h"
 
 using namespace phenyl::core;
 
@@ -19,7 +21,10 @@ void ResourceManager::registerResource (std::size_t typeIndex, IResource* resour
     PHENYL_LOGI(LOGGER, "Registered resource \"{}\"", resource->getName());
 }
 
-PhenylRuntime::PhenylRuntime () : runtimeWorld{} {
+PhenylRuntime::PhenylRuntime () : PhenylRuntime{ThreadPool::DefaultThreads()} {}
+
+PhenylRuntime::PhenylRuntime (std::size_t workerThreads) : runtimeAssets{std::make_unique<Assets>()}, runtimeWorld{} {
+    auto assetScope = makeCurrent();
     PHENYL_LOGI(LOGGER, "Initialised Phenyl runtime");
     initStage<PostInit>("PostInit");
     initStage<FrameBegin>("FrameBegin");
@@ -35,14 +40,22 @@ PhenylRuntime::PhenylRuntime () : runtimeWorld{} {
 
     addResource<DeltaTime>();
     addResource<FixedDelta>();
+    addResource<ThreadPool>(workerThreads);
+}
+
+PhenylRuntime::~PhenylRuntime () {
+    destructionScope = std::make_unique<AssetScope>(*runtimeAssets);
 }
 
-PhenylRuntime::~PhenylRuntime () = default;
+AssetScope PhenylRuntime::makeCurrent () {
+    return AssetScope{*runtimeAssets};
+}
 
 void PhenylRuntime::registerPlugin (std::size_t typeIndex, std::unique_ptr<IPlugin> plugin) {
     PHENYL_DASSERT(!plugins.contains(typeIndex));
     PHENYL_TRACE(LOGGER, "Starting registration of plugin \"{}\"", plugin->getName());
 
+    auto assetScope = makeCurrent();
     auto& pluginRef = *plugin;
 
     plugins.emplace(typeIndex, std::move(plugin));
@@ -55,6 +68,7 @@ void PhenylRuntime::registerPlugin (std::size_t typeIndex, IInitPlugin& plugin)
     PHENYL_DASSERT(!initPlugins.contains(typeIndex));
     PHENYL_TRACE(LOGGER, "Starting registration of init plugin \"{}\"", plugin.getName());
 
+    auto assetScope = makeCurrent();
     initPlugins.emplace(typeIndex);
 
     plugin.init(*this);
@@ -62,33 +76,65 @@ void PhenylRuntime::registerPlugin (std::size_t typeIndex, IInitPlugin& plugin)
 }
 
 void PhenylRuntime::runPostInit () {
+    auto assetScope = makeCurrent();
     PHENYL_TRACE(LOGGER, "Initiating PostInit stage");
     getStage<PostInit>()->run();
 }
 
 void PhenylRuntime::runFrameBegin () {
+    auto assetScope = makeCurrent();
     PHENYL_TRACE(LOGGER, "Initiating FrameBegin stage");
     getStage<FrameBegin>()->run();
 }
 
 void PhenylRuntime::runFixedTimestep (double deltaTime) {
+    auto assetScope = makeCurrent();
     PHENYL_TRACE(LOGGER, "Initiating GlobalFixedTimestep stage");
     resource<FixedDelta>().set(deltaTime);
     getStage<GlobalFixedTimestep>()->run();
+
+    runReducedStep<GlobalFixedTimestep, FixedDelta>(reducedFixedTime, deltaTime);
 }
 
 void PhenylRuntime::runVariableTimestep (double deltaTime) {
+    auto assetScope = makeCurrent();
     PHENYL_TRACE(LOGGER, "Initating GlobalVariableTimestep stage");
     resource<DeltaTime>().set(deltaTime);
     getStage<GlobalVariableTimestep>()->run();
+
+    runReducedStep<GlobalVariableTimestep, DeltaTime>(reducedVariableTime, deltaTime);
+}
+
+template <typename S, typename Delta>
+void PhenylRuntime::runReducedStep (ReducedTime& reduced, double deltaTime) {
+    reduced.time += deltaTime;
+    if (++reduced.steps < runtimeWorld.reducedInterval()) {
+        return;
+    }
+
+    // Reduced entities catch up on all the time they skipped in a single step
+    auto reducedDelta = reduced.time;
+    reduced = ReducedTime{};
+    if (!runtimeWorld.hasReduced()) {
+        return;
+    }
+
+    PHENYL_TRACE(LOGGER, "Initiating reduced {} stage", getStage<S>()->name());
+    resource<Delta>().set(reducedDelta);
+    runtimeWorld.beginReducedStep();
+    getStage<S>()->run();
+    runtimeWorld.endReducedStep();
+    resource<Delta>().set(deltaTime);
 }
 
 void PhenylRuntime::runRender () {
+    auto assetScope = makeCurrent();
     PHENYL_TRACE(LOGGER, "Initating Render stage");
     getStage<Render>()->run();
 }
 
 void PhenylRuntime::shutdown () {
+    auto assetScope = makeCurrent();
     PHENYL_LOGI(LOGGER, "Shutting down runtime!");
 
     PHENYL_TRACE(LOGGER, "Clearing entities");
@@ -105,4 +151,8 @@ void PhenylRuntime::shutdown () {
 
     PHENYL_TRACE(LOGGER, "Destructing plugins");
     plugins.clear();
+
+    // Resources may own renderer objects, so must go while the renderer is still alive
+    PHENYL_TRACE(LOGGER, "Destructing resources");
+    resourceManager.clear();
 }
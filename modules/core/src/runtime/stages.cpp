@@ -1,3 +1,4 @@
+#include "util/profiler.h"
 #include "util/random.h"
 
 #include "core/runtime/stage.h"
@@ -23,13 +24,27 @@ void AbstractStage::run () {
         updated = false;
     }
 
+    // Per system timings are read back with util::getProfileTime(name)
+    auto profileSystems = util::detailedProfiling();
+    auto reducedStep = runtime.world().reducedStep();
+
     runtime.world().defer();
     for (auto* i : orderedSystems) {
+        if (reducedStep && !i->runsInReducedSteps()) {
+            continue;
+        }
+
         if (i->exclusive()) {
             runtime.world().deferEnd();
         }
 
-        i->run(runtime);
+        if (profileSystems) {
+            util::startProfile(i->getName());
+            i->run(runtime);
+            util::endProfile();
+        } else {
+            i->run(runtime);
+        }
 
         if (i->exclusive()) {
             runtime.world().defer();
@@ -0,0 +1,108 @@
+#include <algorithm>
+
+#include "logging/logging.h"
+
+#include "core/runtime/thread_pool.h"
+
+using namespace phenyl::core;
+
+static phenyl::Logger LOGGER{"THREAD_POOL", phenyl::PHENYL_LOGGER};
+
+std::size_t ThreadPool::DefaultThreads () {
+    auto hardwareThreads = static_cast<std::size_t>(std::thread::hardware_concurrency());
+    return hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+}
+
+ThreadPool::ThreadPool (std::size_t numThreads) {
+    workers.reserve(numThreads);
+    for (std::size_t i = 0; i < numThreads; i++) {
+        workers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+
+    PHENYL_LOGI(LOGGER, "Started thread pool with {} worker threads", numThreads);
+}
+
+ThreadPool::~ThreadPool () {
+    {
+        std::lock_guard lock{mutex};
+        stopping = true;
+    }
+    workCondition.notify_all();
+
+    for (auto& i : workers) {
+        i.join();
+    }
+}
+
+void ThreadPool::parallelFor (std::size_t count, std::size_t minChunk, const std::function<void(std::size_t, std::size_t)>& fn) {
+    if (!count) {
+        return;
+    }
+
+    auto chunks = std::min(size(), (count + std::max(minChunk, std::size_t{1}) - 1) / std::max(minChunk, std::size_t{1}));
+    if (chunks <= 1) {
+        // Not worth waking workers
+        fn(0, count);
+        return;
+    }
+
+    {
+        std::unique_lock lock{mutex};
+        PHENYL_DASSERT_MSG(!currentJob, "Nested parallelFor() is not supported");
+
+        // Workers that woke late for the previous job may still be reading its state
+        doneCondition.wait(lock, [&] { return activeWorkers == 0; });
+
+        currentJob = &fn;
+        jobSize = count;
+        numChunks = chunks;
+        nextChunk.store(0);
+        chunksDone = 0;
+        generation++;
+    }
+    workCondition.notify_all();
+
+    runChunks();
+
+    std::unique_lock lock{mutex};
+    // Wait for stragglers to leave runChunks() as well, so they cannot pick up chunks of the next job
+    doneCondition.wait(lock, [&] { return chunksDone == numChunks && activeWorkers == 0; });
+    currentJob = nullptr;
+}
+
+void ThreadPool::workerLoop () {
+    std::uint64_t seenGeneration = 0;
+
+    std::unique_lock lock{mutex};
+    while (true) {
+        workCondition.wait(lock, [&] { return stopping || generation != seenGeneration; });
+        if (stopping) {
+            return;
+        }
+
+        seenGeneration = generation;
+        activeWorkers++;
+        lock.unlock();
+
+        runChunks();
+
+        lock.lock();
+        if (!--activeWorkers) {
+            doneCondition.notify_all();
+        }
+    }
+}
+
+void ThreadPool::runChunks () {
+    std::size_t chunk;
+    while ((chunk = nextChunk.fetch_add(1)) < numChunks) {
+        auto begin = jobSize * chunk / numChunks;
+        auto end = jobSize * (chunk + 1) / numChunks;
+        (*currentJob)(begin, end);
+
+        std::lock_guard lock{mutex};
+        if (++chunksDone == numChunks) {
+            doneCondition.notify_all();
+        }
+    }
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <limits>
+
+#include "graphics/maths_headers.h"
+
+namespace phenyl::graphics {
+    // Axis aligned rectangle in world space
+    struct Bounds2D {
+        glm::vec2 min{std::numeric_limits<float>::max()};
+        glm::vec2 max{std::numeric_limits<float>::lowest()};
+
+        // Bounds of a quad spanning centre + transform * [-1, 1]^2
+        static Bounds2D OfQuad (glm::vec2 centre, const glm::mat2& transform) noexcept {
+            glm::vec2 halfExtents = glm::abs(transform[0]) + glm::abs(transform[1]);
+            return Bounds2D{.min = centre - halfExtents, .max = centre + halfExtents};
+        }
+
+        [[nodiscard]] bool empty () const noexcept {
+            return min.x > max.x || min.y > max.y;
+        }
+
+        [[nodiscard]] bool intersects (const Bounds2D& other) const noexcept {
+            return min.x <= other.max.x && other.min.x <= max.x && min.y <= other.max.y && other.min.y <= max.y;
+        }
+
+        void extend (glm::vec2 point, float radius = 0.0f) noexcept {
+            min = glm::min(min, point - radius);
+            max = glm::max(max, point + radius);
+        }
+    };
+}
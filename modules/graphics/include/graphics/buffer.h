@@ -1,26 +1,62 @@
 #pragma once
 
+#include <algorithm>
 #include <memory>
+#include <span>
+#include <type_traits>
 #include <vector>
 
 #include "logging/logging.h"
 
 namespace phenyl::graphics {
+    enum class BufferStorage {
+        // Written to a CPU side vector and copied to the renderer on upload()
+        STAGED,
+        // Written directly into renderer owned storage, rotated between the frames the renderer has in flight
+        STREAMED
+    };
+
     class IBuffer {
     public:
         virtual ~IBuffer() = default;
 
         virtual void upload (unsigned char* data, std::size_t size) = 0;
+
+        // Streamed buffers only. Returns the storage for the current frame, at least minCapacity bytes long and
+        // keeping the first keepSize bytes already written to it this frame
+        virtual std::span<unsigned char> map (std::size_t minCapacity, std::size_t keepSize) = 0;
+        // Streamed buffers only. Makes the first size bytes written to the mapped storage visible to draws
+        virtual void commit (std::size_t size) = 0;
     };
 
     template <typename T>
     class Buffer {
     private:
+        static_assert(std::is_trivially_copyable_v<T>, "Buffer elements are copied to the renderer bytewise");
+
         std::unique_ptr<IBuffer> rendererBuffer;
         std::vector<T> data;
+
+        // Streamed storage of the current frame, mapped on first write after clear()
+        T* mapped = nullptr;
+        std::size_t mappedSize = 0;
+        std::size_t mappedCapacity = 0;
+        bool streamed = false;
+
+        void ensureMapped (std::size_t capacity) {
+            if (mapped && capacity <= mappedCapacity) {
+                return;
+            }
+
+            // Grow geometrically within a frame, the renderer keeps the grown storage for later frames
+            auto requested = mapped ? std::max(capacity, mappedCapacity * 2) : capacity;
+            auto storage = rendererBuffer->map(requested * sizeof(T), mappedSize * sizeof(T));
+            mapped = reinterpret_cast<T*>(storage.data());
+            mappedCapacity = storage.size() / sizeof(T);
+        }
     public:
         Buffer () : rendererBuffer{}, data{} {}
-        explicit Buffer (std::unique_ptr<IBuffer> rendererBuffer) : rendererBuffer{std::move(rendererBuffer)}, data{} {}
+        explicit Buffer (std::unique_ptr<IBuffer> rendererBuffer, BufferStorage storage = BufferStorage::STAGED) : rendererBuffer{std::move(rendererBuffer)}, data{}, streamed{storage == BufferStorage::STREAMED} {}
 
         explicit operator bool () const {
             return (bool)rendererBuffer;
@@ -29,31 +65,70 @@ namespace phenyl::graphics {
         template <typename ...Args>
         std::size_t emplace (Args&&... args) {
             auto index = size();
-            data.emplace_back(std::forward<Args>(args)...);
+            if (streamed) {
+                ensureMapped(mappedSize + 1);
+                std::construct_at(mapped + mappedSize, std::forward<Args>(args)...);
+                mappedSize++;
+            } else {
+                data.emplace_back(std::forward<Args>(args)...);
+            }
             return index;
         }
 
         template <std::input_iterator It>
         std::size_t insertRange (It begin, It end) {
             auto startIndex = size();
-            data.insert(data.end(), begin, end);
+            if (streamed) {
+                for (; begin != end; ++begin) {
+                    emplace(*begin);
+                }
+            } else {
+                data.insert(data.end(), begin, end);
+            }
             return startIndex;
         }
 
+        // Appends count elements and returns them to be written in place. Streamed buffers leave them uninitialised.
+        std::span<T> allocate (std::size_t count) {
+            auto startIndex = size();
+            if (streamed) {
+                ensureMapped(mappedSize + count);
+                mappedSize += count;
+                return {mapped + startIndex, count};
+            } else {
+                data.resize(startIndex + count);
+                return {data.data() + startIndex, count};
+            }
+        }
+
         void reserve (std::size_t newSize) {
-            data.reserve(newSize);
+            if (streamed) {
+                ensureMapped(newSize);
+            } else {
+                data.reserve(newSize);
+            }
         }
 
         std::size_t size () const {
-            return data.size();
+            return streamed ? mappedSize : data.size();
         }
 
         void clear () {
-            data.clear();
+            if (streamed) {
+                // The next write maps the storage of the frame it happens in
+                mapped = nullptr;
+                mappedSize = 0;
+            } else {
+                data.clear();
+            }
         }
 
         void upload () {
-            rendererBuffer->upload(reinterpret_cast<unsigned char*>(data.data()), data.size() * sizeof(T));
+            if (streamed) {
+                rendererBuffer->commit(mappedSize * sizeof(T));
+            } else {
+                rendererBuffer->upload(reinterpret_cast<unsigned char*>(data.data()), data.size() * sizeof(T));
+            }
         }
 
         IBuffer& getUnderlying () {
@@ -66,4 +141,4 @@ namespace phenyl::graphics {
             return *rendererBuffer;
         }
     };
-}
\ No newline at end of file
+}
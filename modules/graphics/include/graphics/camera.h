@@ -3,6 +3,7 @@
 #include <string>
 
 #include "viewport.h"
+#include "graphics/bounds_2d.h"
 #include "graphics/maths_headers.h"
 #include "core/iresource.h"
 
@@ -27,6 +28,8 @@ namespace phenyl::graphics {
         explicit Camera (glm::vec2 resolution);
 
         glm::vec2 getWorldPos2D (glm::vec2 screenPos) const;
+        // World space rectangle visible through the camera
+        [[nodiscard]] Bounds2D getViewBounds2D () const;
 
         std::string_view getName() const noexcept override;
 
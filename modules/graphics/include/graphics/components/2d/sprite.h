@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <utility>
 
 #include "graphics/maths_headers.h"
@@ -13,7 +14,16 @@ namespace phenyl::graphics {
 
         glm::vec2 uvStart{0, 0};
         glm::vec2 uvEnd{1, 1};
+
+        // Lower layers are drawn first, then lower depth within a layer. Sprites that tie keep query order.
+        std::int16_t layer = 0;
+        float depth = 0.0f;
     };
 
+    // Marks a sprite as scenery that does not change. Static sprites are baked into retained per region buffers
+    // instead of being extracted every frame. To move or change one, erase StaticSprite2D and insert it again.
+    struct StaticSprite2D {};
+
     PHENYL_DECLARE_SERIALIZABLE(Sprite2D)
+    PHENYL_DECLARE_SERIALIZABLE(StaticSprite2D)
 }
\ No newline at end of file
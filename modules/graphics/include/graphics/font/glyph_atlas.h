@@ -9,18 +9,28 @@
 #include "graphics/texture.h"
 
 namespace phenyl::graphics {
-    struct ColumnAtlas {
+    // Packs rectangles into fixed width columns of a square page, in the order they arrive
+    struct ColumnPacker {
         struct Column {
             std::uint32_t offset;
             std::uint32_t width;
             std::uint32_t currHeight;
         };
 
-        Image atlasImage;
-        std::uint32_t index;
+        std::uint32_t size;
         std::vector<Column> columns;
         std::uint32_t currWidth = 0;
         std::uint32_t padding;
+
+        explicit ColumnPacker (std::uint32_t size, std::uint32_t padding = 1);
+
+        std::optional<glm::uvec2> allocate (glm::uvec2 dims);
+    };
+
+    struct ColumnAtlas {
+        Image atlasImage;
+        std::uint32_t index;
+        ColumnPacker packer;
         bool needsUpload = false;
 
         explicit ColumnAtlas (std::uint32_t index, std::uint32_t size, std::uint32_t padding = 1);
@@ -9,6 +9,7 @@ namespace phenyl::graphics {
         int windowHeight = 600;
         std::string windowTitle = "Phenyl Engine";
         bool vsync = false;
+        bool headless = false;
     public:
         GraphicsProperties () = default;
 
@@ -31,6 +32,13 @@ namespace phenyl::graphics {
             return *this;
         }
 
+        // Runs without a window or GPU. Nothing is drawn and there are no input devices.
+        GraphicsProperties& withHeadless (bool isHeadless) {
+            headless = isHeadless;
+
+            return *this;
+        }
+
         [[nodiscard]] int getWindowWidth () const {
             return windowWidth;
         }
@@ -46,5 +54,9 @@ namespace phenyl::graphics {
         bool getVsync () const {
             return vsync;
         }
+
+        [[nodiscard]] bool isHeadless () const {
+            return headless;
+        }
     };
 }
\ No newline at end of file
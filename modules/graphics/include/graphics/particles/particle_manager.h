@@ -24,7 +24,8 @@ namespace phenyl::graphics {
 
         void update (float deltaTime);
 
-        void buffer (Buffer<glm::vec2>& posBuffer, Buffer<glm::vec4>& colourBuffer) const;
+        // Buffers the systems with particles in view
+        void buffer (Buffer<glm::vec2>& posBuffer, Buffer<glm::vec4>& colourBuffer, const Bounds2D& viewBounds) const;
 
         [[nodiscard]] std::string_view getName() const noexcept override;
     };
@@ -6,6 +6,7 @@
 
 #include "graphics/maths_headers.h"
 #include "util/optional.h"
+#include "graphics/bounds_2d.h"
 #include "graphics/buffer.h"
 
 namespace phenyl::graphics {
@@ -68,6 +69,8 @@ namespace phenyl::graphics {
         std::size_t startIndex;
         std::size_t size;
         std::size_t activeNum;
+        // Covers every active particle, updated with the particles
+        Bounds2D particleBounds;
 
         void addParticle (glm::vec2 worldPos, glm::vec2 direction, std::size_t index);
     public:
@@ -77,6 +80,10 @@ namespace phenyl::graphics {
 
         void update (float deltaTime);
 
+        [[nodiscard]] const Bounds2D& bounds () const noexcept {
+            return particleBounds;
+        }
+
         void bufferPos (Buffer<glm::vec2>& buffer) const;
         void bufferColour (Buffer<glm::vec4>& buffer) const;
     };
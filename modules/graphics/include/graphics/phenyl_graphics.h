@@ -4,7 +4,11 @@
 
 #include "graphics/renderer.h"
 #include "graphics_properties.h"
+#include "render_command_log.h"
 
 namespace phenyl::graphics {
     std::unique_ptr<Renderer> MakeGLRenderer (const GraphicsProperties& properties);
+    // Renderer without a window or GPU, see GraphicsProperties::withHeadless(). Records the commands it is sent into log
+    // if given, which must outlive the renderer.
+    std::unique_ptr<Renderer> MakeNullRenderer (const GraphicsProperties& properties, RenderCommandLog* log = nullptr);
 }
\ No newline at end of file
@@ -52,7 +52,9 @@ namespace phenyl::graphics {
         virtual void bindUniform (std::size_t type, UniformBinding binding, IUniformBuffer& buffer) = 0;
         virtual void bindSampler (SamplerBinding binding, const ISampler& sampler) = 0;
         virtual void unbindIndexBuffer () = 0;
-        virtual void render (std::size_t vertices, std::size_t offset) = 0; // TODO: command buffer
+        virtual void render (std::size_t vertices, std::size_t offset) = 0;
+        // Draws the same vertices numInstances times, starting at instance offset of INSTANCE rate buffers
+        virtual void renderInstanced (std::size_t numInstances, std::size_t vertices, std::size_t offset) = 0;
     };
 
     class Pipeline {
@@ -115,6 +117,11 @@ namespace phenyl::graphics {
             PHENYL_DASSERT(pipeline);
             pipeline->render(vertices, offset);
         }
+
+        void renderInstanced (std::size_t numInstances, std::size_t vertices, std::size_t offset=0) {
+            PHENYL_DASSERT(pipeline);
+            pipeline->renderInstanced(numInstances, vertices, offset);
+        }
     };
 
     class IPipelineBuilder {
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace phenyl::graphics {
+    enum class RenderCommandType {
+        BUFFER_UPLOAD,
+        UNIFORM_UPLOAD,
+        TEXTURE_UPLOAD,
+        BUFFER_BIND,
+        INDEX_BUFFER_BIND,
+        UNIFORM_BIND,
+        SAMPLER_BIND,
+        PIPELINE_BIND,
+        ELIDED_BIND,
+        DRAW
+    };
+
+    // For uploads, target is the uploaded object and size the number of bytes. For binds, target is the pipeline, size
+    // the binding and object the bound object. Pipeline binds are recorded before a draw switches pipelines. Binds of
+    // what is already bound are recorded as elided binds instead, with size the type of bind skipped. For draws, target
+    // is the pipeline, size the number of vertices (over all instances for instanced draws) and object the offset.
+    struct RenderCommand {
+        RenderCommandType type;
+        std::size_t target;
+        std::size_t size;
+        std::size_t object;
+    };
+
+    // Commands issued to the null renderer, to measure and check what render layers would have sent to the GPU
+    class RenderCommandLog {
+    private:
+        std::vector<RenderCommand> commands;
+        std::size_t numFrames = 0;
+    public:
+        void record (const RenderCommand& command) {
+            commands.emplace_back(command);
+        }
+
+        void endFrame () {
+            numFrames++;
+        }
+
+        void clear () {
+            commands.clear();
+            numFrames = 0;
+        }
+
+        [[nodiscard]] const std::vector<RenderCommand>& getCommands () const noexcept {
+            return commands;
+        }
+
+        [[nodiscard]] std::size_t frames () const noexcept {
+            return numFrames;
+        }
+
+        [[nodiscard]] std::size_t count (RenderCommandType type) const noexcept {
+            std::size_t total = 0;
+            for (const auto& i : commands) {
+                total += i.type == type ? 1 : 0;
+            }
+
+            return total;
+        }
+
+        [[nodiscard]] std::size_t uploadedBytes () const noexcept {
+            std::size_t total = 0;
+            for (const auto& i : commands) {
+                if (i.type == RenderCommandType::BUFFER_UPLOAD || i.type == RenderCommandType::UNIFORM_UPLOAD || i.type == RenderCommandType::TEXTURE_UPLOAD) {
+                    total += i.size;
+                }
+            }
+
+            return total;
+        }
+
+        [[nodiscard]] std::size_t drawnVertices () const noexcept {
+            std::size_t total = 0;
+            for (const auto& i : commands) {
+                total += i.type == RenderCommandType::DRAW ? i.size : 0;
+            }
+
+            return total;
+        }
+    };
+}
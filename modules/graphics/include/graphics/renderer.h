@@ -3,6 +3,7 @@
 #include <vector>
 #include <optional>
 #include <memory>
+#include <string>
 
 #include "core/iresource.h"
 #include "buffer.h"
@@ -11,6 +12,7 @@
 #include "texture.h"
 
 #include "util/optional.h"
+#include "util/profiler.h"
 #include "graphics/viewport.h"
 #include "pipeline.h"
 #include "graphics/abstract_render_layer.h"
@@ -21,16 +23,29 @@
 namespace phenyl::graphics {
     class Renderer : public core::IResource {
     private:
-        std::vector<std::unique_ptr<AbstractRenderLayer>> layers;
+        struct RenderLayerEntry {
+            std::unique_ptr<AbstractRenderLayer> layer;
+            // Stored so profiling a layer does not build its name every frame
+            std::string profileName;
+        };
+
+        std::vector<RenderLayerEntry> layers;
     protected:
-        virtual std::unique_ptr<IBuffer> makeRendererBuffer (std::size_t startCapacity, std::size_t elementSize) = 0;
+        virtual std::unique_ptr<IBuffer> makeRendererBuffer (std::size_t startCapacity, std::size_t elementSize, BufferStorage storage) = 0;
         virtual std::unique_ptr<IUniformBuffer> makeRendererUniformBuffer (bool readable) = 0;
         virtual std::unique_ptr<IImageTexture> makeRendererImageTexture (const TextureProperties& properties) = 0;
         virtual std::unique_ptr<IImageArrayTexture> makeRendererArrayTexture (const TextureProperties& properties, std::uint32_t width, std::uint32_t height) = 0;
 
         void layerRender () {
-            for (auto& i : layers) {
-                i->render();
+            auto profileLayers = util::detailedProfiling();
+            for (auto& [layer, profileName] : layers) {
+                if (profileLayers) {
+                    util::startProfile(profileName);
+                    layer->render();
+                    util::endProfile();
+                } else {
+                    layer->render();
+                }
             }
         }
     public:
@@ -50,8 +65,8 @@ namespace phenyl::graphics {
         virtual const Viewport& getViewport () const = 0;
 
         template <typename T>
-        Buffer<T> makeBuffer (std::size_t capacity) {
-            return Buffer<T>(makeRendererBuffer(sizeof(T) * capacity, sizeof(T)));
+        Buffer<T> makeBuffer (std::size_t capacity, BufferStorage storage = BufferStorage::STAGED) {
+            return Buffer<T>(makeRendererBuffer(sizeof(T) * capacity, sizeof(T), storage), storage);
         }
 
         template <typename T, typename ...Args>
@@ -81,10 +96,12 @@ namespace phenyl::graphics {
 
         template <std::derived_from<AbstractRenderLayer> T, typename ...Args>
         T& addLayer (Args&&... args) requires std::constructible_from<T, Args&&...> {
-            auto* ptr = layers.emplace_back(std::make_unique<T>(std::forward<Args>(args)...)).get();
+            auto layer = std::make_unique<T>(std::forward<Args>(args)...);
+            auto* ptr = layer.get();
+            layers.emplace_back(RenderLayerEntry{.layer = std::move(layer), .profileName = std::string{ptr->getName()}});
 
             std::sort(layers.begin(), layers.end(), [] (const auto& lhs, const auto& rhs) {
-                return lhs->getPriority() < rhs->getPriority();
+                return lhs.layer->getPriority() < rhs.layer->getPriority();
             });
 
             ptr->init(*this);
@@ -11,10 +11,17 @@ namespace phenyl::graphics {
         TRILINEAR
     };
 
+    // How UVs outside of [0, 1] are sampled
+    enum class TextureWrap {
+        REPEAT,
+        CLAMP
+    };
+
     struct TextureProperties {
         ImageFormat format = ImageFormat::R;
         TextureFilter filter = TextureFilter::POINT;
         bool useMipmapping = true;
+        TextureWrap wrap = TextureWrap::REPEAT;
     };
 
     class ISampler {
@@ -32,6 +39,9 @@ namespace phenyl::graphics {
         [[nodiscard]] virtual std::uint32_t height () const noexcept = 0;
 
         virtual void upload (const Image& image) = 0;
+        // Allocates uninitialised storage, to be filled in with uploadRegion()
+        virtual void allocate (std::uint32_t width, std::uint32_t height) = 0;
+        virtual void uploadRegion (const Image& image, glm::uvec2 offset) = 0;
         [[nodiscard]] virtual const ISampler& sampler () const noexcept = 0;
     };
 
@@ -62,6 +72,11 @@ namespace phenyl::graphics {
 
         [[nodiscard]] virtual const ISampler& sampler () const noexcept = 0;
 
+        // Region of sampler() covered by this texture, as (uvStart, uvEnd)
+        [[nodiscard]] virtual glm::vec4 uvRect () const noexcept {
+            return {0.0f, 0.0f, 1.0f, 1.0f};
+        }
+
         [[nodiscard]] std::size_t hash () const noexcept {
             return texHash;
         }
@@ -90,6 +105,14 @@ namespace phenyl::graphics {
             rendererTexture->upload(image);
         }
 
+        void allocate (std::uint32_t width, std::uint32_t height) {
+            rendererTexture->allocate(width, height);
+        }
+
+        void uploadRegion (const Image& image, glm::uvec2 offset) {
+            rendererTexture->uploadRegion(image, offset);
+        }
+
         [[nodiscard]] const ISampler& sampler () const noexcept override {
             return rendererTexture->sampler();
         }
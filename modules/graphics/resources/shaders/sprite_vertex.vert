@@ -1,18 +1,23 @@
 #version 430
 
+// Per instance attributes, the quad itself is expanded from gl_VertexID
 layout(location = 0) in vec2 position;
-layout(location = 1) in vec2 uvOut;
-//layout(location = 2) in vec2 absolutePos;
-//layout(location = 3) in mat2 transform;
+layout(location = 1) in mat2 transform;
+layout(location = 3) in vec4 uvRect;
 out vec2 uv;
-//uniform mat4 camera;
 layout(std140) uniform Camera {
     mat4 camera;
 };
+
+const vec2 CORNERS[6] = vec2[6](
+    vec2(-1, 1), vec2(1, 1), vec2(1, -1),
+    vec2(-1, 1), vec2(1, -1), vec2(-1, -1)
+);
+
 void main () {
-    //gl_Position = camera * vec4((transform * position + absolutePos), 0, 1);
-    //gl_Position = camera * vec4(transform * position + absolutePos, 0, 1);
-    gl_Position = camera * vec4(position, 0, 1);
-    //gl_Position = vec4(position, 0, 1);
-    uv = uvOut;
-}
\ No newline at end of file
+    vec2 corner = CORNERS[gl_VertexID];
+    gl_Position = camera * vec4(transform * corner + position, 0, 1);
+
+    // (-1, 1) maps to the start of the UV rect and (1, -1) to the end
+    uv = mix(uvRect.xy, uvRect.zw, vec2(corner.x, -corner.y) * 0.5 + 0.5);
+}
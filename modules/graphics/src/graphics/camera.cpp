@@ -43,6 +43,18 @@ glm::vec2 Camera::getWorldPos2D (glm::vec2 screenPos) const {
     return glm::vec2{worldPos4.x, worldPos4.y};
 }
 
+Bounds2D Camera::getViewBounds2D () const {
+    auto invMatrix = glm::inverse(camMatrix);
+
+    Bounds2D bounds;
+    for (auto corner : {glm::vec2{-1, -1}, glm::vec2{1, -1}, glm::vec2{-1, 1}, glm::vec2{1, 1}}) {
+        auto worldPos = invMatrix * glm::vec4{corner, 0, 1};
+        bounds.extend(glm::vec2{worldPos.x, worldPos.y});
+    }
+
+    return bounds;
+}
+
 void Camera::setPos2D (glm::vec2 newPos) {
     positionMat = glm::translate(glm::mat4(1.0f), glm::vec3(-newPos, 0.0f));
     camMatrix = scaleMat * positionMat;
@@ -6,4 +6,5 @@ using namespace phenyl::graphics;
 
 namespace phenyl::graphics {
     PHENYL_SERIALIZABLE(Sprite2D, PHENYL_SERIALIZABLE_MEMBER(texture))
+    PHENYL_SERIALIZABLE(StaticSprite2D)
 }
\ No newline at end of file
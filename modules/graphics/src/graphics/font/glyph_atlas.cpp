@@ -2,36 +2,46 @@
 
 using namespace phenyl::graphics;
 
-ColumnAtlas::ColumnAtlas (std::uint32_t index, std::uint32_t size, std::uint32_t padding) : atlasImage{size, size, ImageFormat::R}, index{index}, padding{padding} {}
+ColumnPacker::ColumnPacker (std::uint32_t size, std::uint32_t padding) : size{size}, padding{padding} {}
 
-std::optional<glm::uvec2> ColumnAtlas::place (const Image& image) {
+std::optional<glm::uvec2> ColumnPacker::allocate (glm::uvec2 dims) {
     Column* column = nullptr;
 
     for (auto& col : columns) {
-        if (col.width >= image.width() && atlasImage.height() - col.currHeight >= image.height()) {
+        if (col.width >= dims.x && size - col.currHeight >= dims.y) {
             column = &col;
             break;
         }
     }
 
     if (!column) {
-        if (atlasImage.width() - currWidth < image.width()) {
+        if (size - currWidth < dims.x) {
             return std::nullopt;
         }
 
         column = &columns.emplace_back(Column{
             .offset = currWidth,
-            .width = image.width(),
+            .width = dims.x,
             .currHeight = 0
         });
-        currWidth = std::min(atlasImage.width(), currWidth + image.width() + padding);
+        currWidth = std::min(size, currWidth + dims.x + padding);
     }
 
     glm::uvec2 off{column->offset, column->currHeight};
-    atlasImage.blit(image, off);
+    column->currHeight = std::min(size, column->currHeight + dims.y + padding);
+
+    return off;
+}
 
-    column->currHeight = std::min(atlasImage.height(), column->currHeight + image.height() + padding);
+ColumnAtlas::ColumnAtlas (std::uint32_t index, std::uint32_t size, std::uint32_t padding) : atlasImage{size, size, ImageFormat::R}, index{index}, packer{size, padding} {}
+
+std::optional<glm::uvec2> ColumnAtlas::place (const Image& image) {
+    auto off = packer.allocate({image.width(), image.height()});
+    if (!off) {
+        return std::nullopt;
+    }
 
+    atlasImage.blit(image, *off);
     needsUpload = true;
 
     return off;
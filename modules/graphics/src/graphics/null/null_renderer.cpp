@@ -0,0 +1,100 @@
+#include "core/assets/assets.h"
+#include "graphics/detail/loggers.h"
+
+#include "null_renderer.h"
+#include "null_resources.h"
+
+using namespace phenyl::graphics;
+
+static phenyl::Logger LOGGER{"NULL_RENDERER", detail::GRAPHICS_LOGGER};
+
+const char* NullShaderManager::getFileType () const {
+    return ".json";
+}
+
+Shader* NullShaderManager::load (std::ifstream& data, std::size_t id) {
+    // Sources are never compiled, so there is nothing to read
+    PHENYL_DASSERT(!shaders.contains(id));
+    shaders[id] = Shader{std::make_unique<NullShader>()};
+    return &shaders[id];
+}
+
+Shader* NullShaderManager::load (Shader&& obj, std::size_t id) {
+    PHENYL_DASSERT(!shaders.contains(id));
+    shaders[id] = std::move(obj);
+    return &shaders[id];
+}
+
+void NullShaderManager::queueUnload (std::size_t id) {
+    if (onUnload(id)) {
+        shaders.erase(id);
+    }
+}
+
+void NullShaderManager::selfRegister () {
+    core::Assets::AddManager(this);
+}
+
+NullRenderer::NullRenderer (const GraphicsProperties& properties, RenderCommandLog* log) : viewport{std::make_unique<NullViewport>(properties)}, log{log} {
+    shaderManager.selfRegister();
+}
+
+std::string_view NullRenderer::getName () const noexcept {
+    return "NullRenderer";
+}
+
+double NullRenderer::getCurrentTime () {
+    return viewport->getTime();
+}
+
+void NullRenderer::clearWindow () {}
+
+void NullRenderer::render () {
+    stateCache.invalidate();
+
+    // Layers reset their buffers when rendering, so must be rendered even with nothing to render to
+    layerRender();
+
+    if (log) {
+        log->endFrame();
+    }
+}
+
+void NullRenderer::finishRender () {}
+
+PipelineBuilder NullRenderer::buildPipeline () {
+    return PipelineBuilder{std::make_unique<NullPipelineBuilder>(log, stateCache)};
+}
+
+void NullRenderer::loadDefaultShaders () {
+    PHENYL_TRACE(LOGGER, "Loading null default shaders");
+    boxShader = core::Assets::LoadVirtual("phenyl/shaders/box", Shader{std::make_unique<NullShader>()});
+    debugShader = core::Assets::LoadVirtual("phenyl/shaders/debug", Shader{std::make_unique<NullShader>()});
+    spriteShader = core::Assets::LoadVirtual("phenyl/shaders/sprite", Shader{std::make_unique<NullShader>()});
+    textShader = core::Assets::LoadVirtual("phenyl/shaders/canvas", Shader{std::make_unique<NullShader>()});
+    particleShader = core::Assets::LoadVirtual("phenyl/shaders/particle", Shader{std::make_unique<NullShader>()});
+}
+
+Viewport& NullRenderer::getViewport () {
+    return *viewport;
+}
+
+const Viewport& NullRenderer::getViewport () const {
+    return *viewport;
+}
+
+std::unique_ptr<IBuffer> NullRenderer::makeRendererBuffer (std::size_t startCapacity, std::size_t elementSize, BufferStorage storage) {
+    return std::make_unique<NullBuffer>(log, startCapacity, storage);
+}
+
+std::unique_ptr<IUniformBuffer> NullRenderer::makeRendererUniformBuffer (bool readable) {
+    return std::make_unique<NullUniformBuffer>(log, readable);
+}
+
+std::unique_ptr<IImageTexture> NullRenderer::makeRendererImageTexture (const TextureProperties& properties) {
+    return std::make_unique<NullImageTexture>(log);
+}
+
+std::unique_ptr<IImageArrayTexture> NullRenderer::makeRendererArrayTexture (const TextureProperties& properties, std::uint32_t width, std::uint32_t height) {
+    return std::make_unique<NullArrayTexture>(log, width, height);
+}
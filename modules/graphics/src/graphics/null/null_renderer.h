@@ -0,0 +1,64 @@
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+
+#include "core/assets/asset_manager.h"
+#include "graphics/renderer.h"
+#include "graphics/graphics_properties.h"
+#include "graphics/render_command_log.h"
+
+#include "null_resources.h"
+#include "null_viewport.h"
+
+namespace phenyl::graphics {
+    class NullShaderManager : public core::AssetManager<Shader> {
+    private:
+        std::unordered_map<std::size_t, Shader> shaders;
+    public:
+        const char* getFileType () const override;
+        Shader* load (std::ifstream& data, std::size_t id) override;
+        Shader* load (Shader&& obj, std::size_t id) override;
+        void queueUnload (std::size_t id) override;
+
+        void selfRegister ();
+    };
+
+    // Renderer that draws nothing, for running without a display or GPU. Render layers run as usual, so their CPU cost
+    // can be measured, and the commands they issue are recorded if there is a log.
+    class NullRenderer : public Renderer {
+    private:
+        std::unique_ptr<NullViewport> viewport;
+        RenderCommandLog* log;
+        NullStateCache stateCache;
+
+        NullShaderManager shaderManager;
+
+        core::Asset<Shader> boxShader;
+        core::Asset<Shader> debugShader;
+        core::Asset<Shader> spriteShader;
+        core::Asset<Shader> textShader;
+        core::Asset<Shader> particleShader;
+    protected:
+        std::unique_ptr<IBuffer> makeRendererBuffer (std::size_t startCapacity, std::size_t elementSize, BufferStorage storage) override;
+        std::unique_ptr<IUniformBuffer> makeRendererUniformBuffer (bool readable) override;
+        std::unique_ptr<IImageTexture> makeRendererImageTexture (const TextureProperties& properties) override;
+        std::unique_ptr<IImageArrayTexture> makeRendererArrayTexture (const TextureProperties& properties, std::uint32_t width, std::uint32_t height) override;
+    public:
+        explicit NullRenderer (const GraphicsProperties& properties, RenderCommandLog* log = nullptr);
+
+        std::string_view getName () const noexcept override;
+
+        double getCurrentTime () override;
+
+        void clearWindow () override;
+        void render () override;
+        void finishRender () override;
+
+        PipelineBuilder buildPipeline () override;
+        void loadDefaultShaders () override;
+
+        Viewport& getViewport () override;
+        const Viewport& getViewport () const override;
+    };
+}
@@ -0,0 +1,271 @@
+#include <atomic>
+#include <bit>
+
+#include "null_resources.h"
+
+using namespace phenyl::graphics;
+
+// Stand in for GL object names, so ids are unique and never 0
+static std::size_t NextId () {
+    static std::atomic<std::size_t> nextId{1};
+    return nextId.fetch_add(1);
+}
+
+NullBuffer::NullBuffer (RenderCommandLog* log, std::size_t capacity, BufferStorage bufferStorage) : log{log}, id{NextId()} {
+    if (bufferStorage == BufferStorage::STREAMED) {
+        storage.resize(capacity);
+    }
+}
+
+void NullBuffer::upload (unsigned char* data, std::size_t size) {
+    if (log) {
+        log->record(RenderCommand{.type=RenderCommandType::BUFFER_UPLOAD, .target=id, .size=size, .object=0});
+    }
+}
+
+std::span<unsigned char> NullBuffer::map (std::size_t minCapacity, std::size_t keepSize) {
+    if (minCapacity > storage.size()) {
+        storage.resize(std::bit_ceil(minCapacity));
+    }
+
+    return storage;
+}
+
+void NullBuffer::commit (std::size_t size) {
+    PHENYL_DASSERT(size <= storage.size());
+
+    // Recorded as an upload so streamed and staged buffers are measured alike
+    if (log) {
+        log->record(RenderCommand{.type=RenderCommandType::BUFFER_UPLOAD, .target=id, .size=size, .object=0});
+    }
+}
+
+NullUniformBuffer::NullUniformBuffer (RenderCommandLog* log, bool readable) : log{log}, id{NextId()}, readable{readable} {}
+
+unsigned char* NullUniformBuffer::allocate (std::size_t requestSize) {
+    data = std::make_unique<unsigned char[]>(requestSize);
+    size = requestSize;
+    return data.get();
+}
+
+void NullUniformBuffer::upload () {
+    if (log) {
+        log->record(RenderCommand{.type=RenderCommandType::UNIFORM_UPLOAD, .target=id, .size=size, .object=0});
+    }
+}
+
+bool NullUniformBuffer::isReadable () const {
+    return readable;
+}
+
+NullSampler::NullSampler () : id{NextId()} {}
+
+std::size_t NullSampler::hash () const noexcept {
+    return id;
+}
+
+NullImageTexture::NullImageTexture (RenderCommandLog* log) : log{log} {}
+
+std::uint32_t NullImageTexture::width () const noexcept {
+    return texWidth;
+}
+
+std::uint32_t NullImageTexture::height () const noexcept {
+    return texHeight;
+}
+
+void NullImageTexture::upload (const Image& image) {
+    texWidth = image.width();
+    texHeight = image.height();
+
+    if (log) {
+        log->record(RenderCommand{.type=RenderCommandType::TEXTURE_UPLOAD, .target=texSampler.hash(), .size=image.data().size(), .object=0});
+    }
+}
+
+void NullImageTexture::allocate (std::uint32_t width, std::uint32_t height) {
+    texWidth = width;
+    texHeight = height;
+}
+
+void NullImageTexture::uploadRegion (const Image& image, glm::uvec2 offset) {
+    PHENYL_DASSERT(offset.x + image.width() <= texWidth && offset.y + image.height() <= texHeight);
+
+    if (log) {
+        log->record(RenderCommand{.type=RenderCommandType::TEXTURE_UPLOAD, .target=texSampler.hash(), .size=image.data().size(), .object=0});
+    }
+}
+
+const ISampler& NullImageTexture::sampler () const noexcept {
+    return texSampler;
+}
+
+NullArrayTexture::NullArrayTexture (RenderCommandLog* log, std::uint32_t width, std::uint32_t height) : log{log}, texWidth{width}, texHeight{height} {}
+
+std::uint32_t NullArrayTexture::width () const noexcept {
+    return texWidth;
+}
+
+std::uint32_t NullArrayTexture::height () const noexcept {
+    return texHeight;
+}
+
+std::uint32_t NullArrayTexture::size () const noexcept {
+    return texSize;
+}
+
+void NullArrayTexture::reserve (std::uint32_t capacity) {}
+
+std::uint32_t NullArrayTexture::append () {
+    return texSize++;
+}
+
+void NullArrayTexture::upload (std::uint32_t index, const Image& image) {
+    PHENYL_DASSERT_MSG(index < texSize, "Attempted to upload to index {} of array texture of size {}", index, texSize);
+
+    if (log) {
+        log->record(RenderCommand{.type=RenderCommandType::TEXTURE_UPLOAD, .target=texSampler.hash(), .size=image.data().size(), .object=index});
+    }
+}
+
+const ISampler& NullArrayTexture::sampler () const noexcept {
+    return texSampler;
+}
+
+NullShader::NullShader () : id{NextId()} {}
+
+std::size_t NullShader::hash () const noexcept {
+    return id;
+}
+
+std::optional<unsigned int> NullShader::getUniformLocation (const std::string& uniform) const noexcept {
+    return 0;
+}
+
+std::optional<unsigned int> NullShader::getSamplerLocation (const std::string& sampler) const noexcept {
+    return 0;
+}
+
+template <typename K>
+static bool UpdateBinding (std::unordered_map<K, std::size_t>& bindings, K binding, std::size_t object) {
+    auto [it, inserted] = bindings.try_emplace(binding, object);
+    if (!inserted && it->second == object) {
+        return false;
+    }
+
+    it->second = object;
+    return true;
+}
+
+bool NullStateCache::usePipeline (std::size_t pipelineId) {
+    if (pipeline == pipelineId) {
+        return false;
+    }
+
+    pipeline = pipelineId;
+    return true;
+}
+
+bool NullStateCache::bindSampler (SamplerBinding binding, std::size_t samplerId) {
+    return UpdateBinding(samplers, binding, samplerId);
+}
+
+bool NullStateCache::bindUniform (UniformBinding binding, std::size_t bufferId) {
+    return UpdateBinding(uniforms, binding, bufferId);
+}
+
+void NullStateCache::invalidate () {
+    currEpoch++;
+    pipeline = 0;
+    samplers.clear();
+    uniforms.clear();
+}
+
+NullPipeline::NullPipeline (RenderCommandLog* log, NullStateCache& stateCache) : log{log}, stateCache{&stateCache}, id{NextId()} {}
+
+void NullPipeline::record (RenderCommandType type, std::size_t size, std::size_t object) {
+    if (log) {
+        log->record(RenderCommand{.type=type, .target=id, .size=size, .object=object});
+    }
+}
+
+void NullPipeline::recordBind (bool changed, RenderCommandType type, std::size_t size, std::size_t object) {
+    if (changed) {
+        record(type, size, object);
+    } else {
+        record(RenderCommandType::ELIDED_BIND, static_cast<std::size_t>(type), object);
+    }
+}
+
+void NullPipeline::syncEpoch () {
+    if (bindingsEpoch != stateCache->epoch()) {
+        boundBuffers.clear();
+        boundIndexBuffer = std::nullopt;
+        bindingsEpoch = stateCache->epoch();
+    }
+}
+
+void NullPipeline::bindBuffer (std::size_t type, BufferBinding binding, IBuffer& buffer) {
+    syncEpoch();
+
+    auto bufferId = static_cast<NullBuffer&>(buffer).getId();
+    recordBind(UpdateBinding(boundBuffers, binding, bufferId), RenderCommandType::BUFFER_BIND, binding, bufferId);
+}
+
+void NullPipeline::bindIndexBuffer (ShaderIndexType type, IBuffer& buffer) {
+    syncEpoch();
+
+    auto bufferId = static_cast<NullBuffer&>(buffer).getId();
+    recordBind(boundIndexBuffer != bufferId, RenderCommandType::INDEX_BUFFER_BIND, 0, bufferId);
+    boundIndexBuffer = bufferId;
+}
+
+void NullPipeline::bindUniform (std::size_t type, UniformBinding binding, IUniformBuffer& buffer) {
+    auto bufferId = static_cast<NullUniformBuffer&>(buffer).getId();
+    recordBind(stateCache->bindUniform(binding, bufferId), RenderCommandType::UNIFORM_BIND, binding, bufferId);
+}
+
+void NullPipeline::bindSampler (SamplerBinding binding, const ISampler& sampler) {
+    recordBind(stateCache->bindSampler(binding, sampler.hash()), RenderCommandType::SAMPLER_BIND, binding, sampler.hash());
+}
+
+void NullPipeline::unbindIndexBuffer () {
+    syncEpoch();
+
+    recordBind(boundIndexBuffer != std::size_t{0}, RenderCommandType::INDEX_BUFFER_BIND, 0, 0);
+    boundIndexBuffer = 0;
+}
+
+void NullPipeline::render (std::size_t vertices, std::size_t offset) {
+    recordBind(stateCache->usePipeline(id), RenderCommandType::PIPELINE_BIND, 0, id);
+    record(RenderCommandType::DRAW, vertices, offset);
+}
+
+void NullPipeline::renderInstanced (std::size_t numInstances, std::size_t vertices, std::size_t offset) {
+    recordBind(stateCache->usePipeline(id), RenderCommandType::PIPELINE_BIND, 0, id);
+    record(RenderCommandType::DRAW, numInstances * vertices, offset);
+}
+
+NullPipelineBuilder::NullPipelineBuilder (RenderCommandLog* log, NullStateCache& stateCache) : log{log}, stateCache{&stateCache} {}
+
+void NullPipelineBuilder::withGeometryType (GeometryType type) {}
+
+void NullPipelineBuilder::withShader (core::Asset<Shader> shader) {}
+
+BufferBinding NullPipelineBuilder::withBuffer (std::size_t type, std::size_t size, BufferInputRate inputRate) {
+    return nextBuffer++;
+}
+
+void NullPipelineBuilder::withAttrib (ShaderDataType type, unsigned int location, BufferBinding binding, std::size_t offset) {}
+
+UniformBinding NullPipelineBuilder::withUniform (std::size_t type, unsigned int location) {
+    return nextUniform++;
+}
+
+SamplerBinding NullPipelineBuilder::withSampler (unsigned int location) {
+    return nextSampler++;
+}
+
+std::unique_ptr<IPipeline> NullPipelineBuilder::build () {
+    return std::make_unique<NullPipeline>(log, *stateCache);
+}
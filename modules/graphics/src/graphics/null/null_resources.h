@@ -0,0 +1,179 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "graphics/buffer.h"
+#include "graphics/pipeline.h"
+#include "graphics/render_command_log.h"
+#include "graphics/shader.h"
+#include "graphics/texture.h"
+#include "graphics/uniform_buffer.h"
+
+namespace phenyl::graphics {
+    // Renderer objects of the null renderer. Everything is accepted and nothing is drawn, but sizes are tracked so
+    // that code reading them back (e.g. atlases) behaves as with a real renderer. Commands are recorded to the log if
+    // there is one.
+
+    class NullBuffer : public IBuffer {
+    private:
+        RenderCommandLog* log;
+        std::size_t id;
+        // Streamed buffers write straight into this, there are no frames in flight to ring buffer over
+        std::vector<unsigned char> storage;
+    public:
+        NullBuffer (RenderCommandLog* log, std::size_t capacity, BufferStorage bufferStorage);
+
+        void upload (unsigned char* data, std::size_t size) override;
+        std::span<unsigned char> map (std::size_t minCapacity, std::size_t keepSize) override;
+        void commit (std::size_t size) override;
+
+        [[nodiscard]] std::size_t getId () const noexcept {
+            return id;
+        }
+    };
+
+    class NullUniformBuffer : public IUniformBuffer {
+    private:
+        RenderCommandLog* log;
+        std::size_t id;
+        std::unique_ptr<unsigned char[]> data;
+        std::size_t size = 0;
+        bool readable;
+    public:
+        NullUniformBuffer (RenderCommandLog* log, bool readable);
+
+        unsigned char* allocate (std::size_t size) override;
+        void upload () override;
+        [[nodiscard]] bool isReadable () const override;
+
+        [[nodiscard]] std::size_t getId () const noexcept {
+            return id;
+        }
+    };
+
+    class NullSampler : public ISampler {
+    private:
+        std::size_t id;
+    public:
+        NullSampler ();
+
+        [[nodiscard]] std::size_t hash () const noexcept override;
+    };
+
+    class NullImageTexture : public IImageTexture {
+    private:
+        RenderCommandLog* log;
+        NullSampler texSampler;
+        std::uint32_t texWidth = 0;
+        std::uint32_t texHeight = 0;
+    public:
+        explicit NullImageTexture (RenderCommandLog* log);
+
+        [[nodiscard]] std::uint32_t width () const noexcept override;
+        [[nodiscard]] std::uint32_t height () const noexcept override;
+        void upload (const Image& image) override;
+        void allocate (std::uint32_t width, std::uint32_t height) override;
+        void uploadRegion (const Image& image, glm::uvec2 offset) override;
+        [[nodiscard]] const ISampler& sampler () const noexcept override;
+    };
+
+    class NullArrayTexture : public IImageArrayTexture {
+    private:
+        RenderCommandLog* log;
+        NullSampler texSampler;
+        std::uint32_t texWidth;
+        std::uint32_t texHeight;
+        std::uint32_t texSize = 0;
+    public:
+        NullArrayTexture (RenderCommandLog* log, std::uint32_t width, std::uint32_t height);
+
+        [[nodiscard]] std::uint32_t width () const noexcept override;
+        [[nodiscard]] std::uint32_t height () const noexcept override;
+        [[nodiscard]] std::uint32_t size () const noexcept override;
+        void reserve (std::uint32_t capacity) override;
+        std::uint32_t append () override;
+        void upload (std::uint32_t index, const Image& image) override;
+        [[nodiscard]] const ISampler& sampler () const noexcept override;
+    };
+
+    class NullShader : public IShader {
+    private:
+        std::size_t id;
+    public:
+        NullShader ();
+
+        [[nodiscard]] std::size_t hash () const noexcept override;
+        // Every uniform block and sampler exists, so layers can be set up with any shader
+        [[nodiscard]] std::optional<unsigned int> getUniformLocation (const std::string& uniform) const noexcept override;
+        [[nodiscard]] std::optional<unsigned int> getSamplerLocation (const std::string& sampler) const noexcept override;
+    };
+
+    // Bind state shared between pipelines, tracked as the OpenGL renderer does so the log shows which binds it skips
+    class NullStateCache {
+    private:
+        std::uint64_t currEpoch = 0;
+        std::size_t pipeline = 0;
+        std::unordered_map<SamplerBinding, std::size_t> samplers;
+        std::unordered_map<UniformBinding, std::size_t> uniforms;
+    public:
+        // Each returns whether the bind changes anything
+        bool usePipeline (std::size_t pipelineId);
+        bool bindSampler (SamplerBinding binding, std::size_t samplerId);
+        bool bindUniform (UniformBinding binding, std::size_t bufferId);
+
+        void invalidate ();
+
+        [[nodiscard]] std::uint64_t epoch () const noexcept {
+            return currEpoch;
+        }
+    };
+
+    class NullPipeline : public IPipeline {
+    private:
+        RenderCommandLog* log;
+        NullStateCache* stateCache;
+        std::size_t id;
+
+        // Buffers attached to the pipeline itself, like the vertex array of an OpenGL pipeline
+        std::unordered_map<BufferBinding, std::size_t> boundBuffers;
+        std::optional<std::size_t> boundIndexBuffer = std::nullopt;
+        std::uint64_t bindingsEpoch = 0;
+
+        void record (RenderCommandType type, std::size_t size, std::size_t object);
+        void recordBind (bool changed, RenderCommandType type, std::size_t size, std::size_t object);
+        void syncEpoch ();
+    public:
+        NullPipeline (RenderCommandLog* log, NullStateCache& stateCache);
+
+        void bindBuffer (std::size_t type, BufferBinding binding, IBuffer& buffer) override;
+        void bindIndexBuffer (ShaderIndexType type, IBuffer& buffer) override;
+        void bindUniform (std::size_t type, UniformBinding binding, IUniformBuffer& buffer) override;
+        void bindSampler (SamplerBinding binding, const ISampler& sampler) override;
+        void unbindIndexBuffer () override;
+        void render (std::size_t vertices, std::size_t offset) override;
+        void renderInstanced (std::size_t numInstances, std::size_t vertices, std::size_t offset) override;
+    };
+
+    class NullPipelineBuilder : public IPipelineBuilder {
+    private:
+        RenderCommandLog* log;
+        NullStateCache* stateCache;
+        BufferBinding nextBuffer = 0;
+        UniformBinding nextUniform = 0;
+        SamplerBinding nextSampler = 0;
+    public:
+        NullPipelineBuilder (RenderCommandLog* log, NullStateCache& stateCache);
+
+        void withGeometryType (GeometryType type) override;
+        void withShader (core::Asset<Shader> shader) override;
+        BufferBinding withBuffer (std::size_t type, std::size_t size, BufferInputRate inputRate) override;
+        void withAttrib (ShaderDataType type, unsigned int location, BufferBinding binding, std::size_t offset) override;
+        UniformBinding withUniform (std::size_t type, unsigned int location) override;
+        SamplerBinding withSampler (unsigned int location) override;
+        std::unique_ptr<IPipeline> build () override;
+    };
+}
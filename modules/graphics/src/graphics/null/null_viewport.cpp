@@ -0,0 +1,41 @@
+#include "graphics/detail/loggers.h"
+
+#include "null_viewport.h"
+
+using namespace phenyl::graphics;
+
+static phenyl::Logger LOGGER{"NULL_VIEWPORT", detail::GRAPHICS_LOGGER};
+
+NullViewport::NullViewport (const GraphicsProperties& properties) : resolution{properties.getWindowWidth(), properties.getWindowHeight()}, startTime{std::chrono::steady_clock::now()} {
+    PHENYL_LOGI(LOGGER, "Running headless with virtual resolution {}x{}", resolution.x, resolution.y);
+}
+
+bool NullViewport::shouldClose () const {
+    return false;
+}
+
+void NullViewport::poll () {}
+
+glm::ivec2 NullViewport::getResolution () const {
+    return resolution;
+}
+
+glm::vec2 NullViewport::getContentScale () const {
+    return {1.0f, 1.0f};
+}
+
+void NullViewport::addUpdateHandler (IViewportUpdateHandler* handler) {
+    // Resolution never changes
+}
+
+void NullViewport::addInputDevices (core::GameInput& manager) {
+    // No input devices without a window
+}
+
+double NullViewport::getTime () const {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+std::string_view NullViewport::getName () const noexcept {
+    return "NullViewport";
+}
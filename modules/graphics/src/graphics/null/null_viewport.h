@@ -0,0 +1,30 @@
+#pragma once
+
+#include <chrono>
+
+#include "graphics/viewport.h"
+#include "graphics/graphics_properties.h"
+
+namespace phenyl::graphics {
+    // Viewport without a window, for running headless. It has a fixed resolution and no input devices, and never asks
+    // to close, so headless applications stop by calling quit().
+    class NullViewport : public Viewport {
+    private:
+        glm::ivec2 resolution;
+        std::chrono::steady_clock::time_point startTime;
+    public:
+        explicit NullViewport (const GraphicsProperties& properties);
+
+        [[nodiscard]] bool shouldClose () const override;
+        void poll () override;
+        [[nodiscard]] glm::ivec2 getResolution () const override;
+        [[nodiscard]] glm::vec2 getContentScale () const override;
+
+        void addUpdateHandler (IViewportUpdateHandler* handler) override;
+        void addInputDevices (core::GameInput& manager) override;
+
+        [[nodiscard]] double getTime () const;
+
+        [[nodiscard]] std::string_view getName () const noexcept override;
+    };
+}
@@ -18,6 +18,17 @@ static GLint GetGlFilter (TextureFilter filter) {
     PHENYL_ABORT("Invalid filter type: {}", (unsigned int)filter);
 }
 
+static GLint GetGlWrap (TextureWrap wrap) {
+    switch (wrap) {
+        case TextureWrap::REPEAT:
+            return GL_REPEAT;
+        case TextureWrap::CLAMP:
+            return GL_CLAMP_TO_EDGE;
+    }
+
+    PHENYL_ABORT("Invalid wrap type: {}", static_cast<unsigned int>(wrap));
+}
+
 static GLint GetGlFormat (ImageFormat format) {
     switch (format) {
         case ImageFormat::R:
@@ -43,6 +54,8 @@ GlArrayTexture::GlArrayTexture (const TextureProperties& properties, std::uint32
     texSampler.bind();
     glTexParameteri(texSampler.type(), GL_TEXTURE_MIN_FILTER, GetGlFilter(properties.filter));
     glTexParameteri(texSampler.type(), GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(texSampler.type(), GL_TEXTURE_WRAP_S, GetGlWrap(properties.wrap));
+    glTexParameteri(texSampler.type(), GL_TEXTURE_WRAP_T, GetGlWrap(properties.wrap));
 
     glTexImage3D(texSampler.type(), 0, GetGlFormat(texSampler.properties().format), static_cast<GLint>(texWidth), static_cast<GLint>(texHeight), static_cast<GLint>(depthCapacity), 0, GetGlFormat(texSampler.properties().format),
                  GetGlFormatType(texSampler.properties().format), nullptr);
@@ -69,6 +82,8 @@ void GlArrayTexture::reserve (std::uint32_t capacity) {
     newSampler.bind();
     glTexParameteri(newSampler.type(), GL_TEXTURE_MIN_FILTER, GetGlFilter(newSampler.properties().filter));
     glTexParameteri(newSampler.type(), GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(newSampler.type(), GL_TEXTURE_WRAP_S, GetGlWrap(newSampler.properties().wrap));
+    glTexParameteri(newSampler.type(), GL_TEXTURE_WRAP_T, GetGlWrap(newSampler.properties().wrap));
 
     glTexImage3D(newSampler.type(), 0, GetGlFormat(newSampler.properties().format), static_cast<GLint>(width()), static_cast<GLint>(height()), static_cast<GLint>(capacity), 0, GetGlFormat(newSampler.properties().format),
                  GetGlFormatType(newSampler.properties().format), nullptr);
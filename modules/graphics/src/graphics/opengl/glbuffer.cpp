@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "graphics/detail/loggers.h"
 #include "glbuffer.h"
 
@@ -5,6 +7,8 @@ using namespace phenyl::graphics;
 
 static phenyl::Logger LOGGER{"GL_BUFFER", detail::GRAPHICS_LOGGER};
 
+#define STREAM_FLAGS (GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT)
+
 GlBuffer::GlBuffer (std::size_t capacity, std::size_t elemSize, GLenum usageHint) : capacity{0}, elemSize{elemSize}, usageHint{usageHint} {
     glCreateBuffers(1, &bufferId);
     PHENYL_TRACE(LOGGER, "Initialised buffer id={}", bufferId);
@@ -12,9 +16,15 @@ GlBuffer::GlBuffer (std::size_t capacity, std::size_t elemSize, GLenum usageHint
     ensureCapacity(capacity);
 }
 
-GlBuffer::GlBuffer (GlBuffer&& other) noexcept : bufferId{other.bufferId}, capacity{other.capacity}, usageHint{other.usageHint} {
+GlBuffer::GlBuffer (std::size_t capacity, std::size_t elemSize, GlFrameSync& frameSync) : usageHint{GL_STREAM_DRAW}, capacity{0}, elemSize{elemSize}, frameSync{&frameSync} {
+    ensureStreamCapacity(capacity, 0);
+}
+
+GlBuffer::GlBuffer (GlBuffer&& other) noexcept : bufferId{other.bufferId}, usageHint{other.usageHint}, capacity{other.capacity}, elemSize{other.elemSize},
+        frameSync{other.frameSync}, mappedData{other.mappedData}, mappedSlot{other.mappedSlot}, committedOffset{other.committedOffset} {
     other.bufferId = 0;
     other.capacity = 0;
+    other.mappedData = nullptr;
 }
 
 GlBuffer::~GlBuffer () {
@@ -31,9 +41,15 @@ GlBuffer& GlBuffer::operator= (GlBuffer&& other) noexcept {
     bufferId = other.bufferId;
     capacity = other.capacity;
     usageHint = other.usageHint;
+    elemSize = other.elemSize;
+    frameSync = other.frameSync;
+    mappedData = other.mappedData;
+    mappedSlot = other.mappedSlot;
+    committedOffset = other.committedOffset;
 
     other.bufferId = 0;
     other.capacity = 0;
+    other.mappedData = nullptr;
 
     return *this;
 }
@@ -49,7 +65,40 @@ void GlBuffer::ensureCapacity (std::size_t requiredCapacity) {
     PHENYL_TRACE(LOGGER, "Resized buffer buffer id={} to {}", bufferId, capacity);
 }
 
+void GlBuffer::ensureStreamCapacity (std::size_t requiredCapacity, std::size_t keepSize) {
+    if (bufferId && requiredCapacity <= capacity) {
+        return;
+    }
+
+    // Persistent storage cannot be resized, so grown buffers are recreated with storage for every frame in flight
+    auto newCapacity = std::bit_ceil(std::max(requiredCapacity, std::size_t{1}));
+    auto totalSize = static_cast<GLsizeiptr>(newCapacity * GlFrameSync::FRAMES_IN_FLIGHT);
+
+    GLuint newId;
+    glCreateBuffers(1, &newId);
+    glNamedBufferStorage(newId, totalSize, nullptr, STREAM_FLAGS);
+    auto* newData = static_cast<unsigned char*>(glMapNamedBufferRange(newId, 0, totalSize, STREAM_FLAGS));
+    PHENYL_ASSERT_MSG(newData, "Failed to map streamed buffer id={}", newId);
+    PHENYL_TRACE(LOGGER, "Initialised streamed buffer id={} with {} bytes per frame", newId, newCapacity);
+
+    if (bufferId) {
+        if (keepSize) {
+            // The mapping is coherent, so the GPU sees what has been written this frame
+            glCopyNamedBufferSubData(bufferId, newId, static_cast<GLintptr>(mappedSlot * capacity), static_cast<GLintptr>(mappedSlot * newCapacity), static_cast<GLsizeiptr>(keepSize));
+        }
+
+        glUnmapNamedBuffer(bufferId);
+        glDeleteBuffers(1, &bufferId);
+    }
+
+    bufferId = newId;
+    capacity = newCapacity;
+    mappedData = newData;
+    committedOffset = mappedSlot * capacity;
+}
+
 void GlBuffer::upload (unsigned char* data, std::size_t size) {
+    PHENYL_DASSERT_MSG(!frameSync, "Attempted to upload to streamed buffer id={}", bufferId);
     ensureCapacity(size);
 
     PHENYL_TRACE(LOGGER, "Uploading {} bytes to buffer id={}", size, bufferId);
@@ -59,3 +108,19 @@ void GlBuffer::upload (unsigned char* data, std::size_t size) {
 void GlBuffer::bind () const {
     glBindBuffer(GL_ARRAY_BUFFER, bufferId);
 }
+
+std::span<unsigned char> GlBuffer::map (std::size_t minCapacity, std::size_t keepSize) {
+    PHENYL_ASSERT_MSG(frameSync, "Attempted to map staged buffer id={}", bufferId);
+
+    mappedSlot = frameSync->slot();
+    ensureStreamCapacity(minCapacity, keepSize);
+
+    return {mappedData + mappedSlot * capacity, capacity};
+}
+
+void GlBuffer::commit (std::size_t size) {
+    PHENYL_DASSERT_MSG(frameSync, "Attempted to commit staged buffer id={}", bufferId);
+    PHENYL_DASSERT(size <= capacity);
+
+    committedOffset = mappedSlot * capacity;
+}
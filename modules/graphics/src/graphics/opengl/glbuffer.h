@@ -3,6 +3,8 @@
 #include "graphics/graphics_headers.h"
 #include "graphics/buffer.h"
 
+#include "glframe_sync.h"
+
 namespace phenyl::graphics {
     class GlBuffer : public IBuffer {
     private:
@@ -11,9 +13,17 @@ namespace phenyl::graphics {
         std::size_t capacity;
         std::size_t elemSize;
 
+        // Streamed buffers only, capacity is per frame slot
+        GlFrameSync* frameSync = nullptr;
+        unsigned char* mappedData = nullptr;
+        std::size_t mappedSlot = 0;
+        std::size_t committedOffset = 0;
+
         void ensureCapacity (std::size_t requiredCapacity);
+        void ensureStreamCapacity (std::size_t requiredCapacity, std::size_t keepSize);
     public:
         GlBuffer (std::size_t capacity, std::size_t elemSize, GLenum usageHint = GL_DYNAMIC_DRAW);
+        GlBuffer (std::size_t capacity, std::size_t elemSize, GlFrameSync& frameSync);
 
         GlBuffer (const GlBuffer&) = delete;
         GlBuffer (GlBuffer&& other) noexcept;
@@ -24,6 +34,8 @@ namespace phenyl::graphics {
         ~GlBuffer() override;
 
         void upload(unsigned char* data, std::size_t size) override;
+        std::span<unsigned char> map (std::size_t minCapacity, std::size_t keepSize) override;
+        void commit (std::size_t size) override;
 
         void bind () const;
 
@@ -34,5 +46,15 @@ namespace phenyl::graphics {
         std::size_t elementSize () const {
             return elemSize;
         }
+
+        // Streamed buffers are recreated on growth and move between frame slots, so must be rebound before each draw
+        [[nodiscard]] bool isStreamed () const noexcept {
+            return frameSync;
+        }
+
+        // Byte offset of the data to draw from
+        [[nodiscard]] std::size_t offset () const noexcept {
+            return committedOffset;
+        }
     };
-}
\ No newline at end of file
+}
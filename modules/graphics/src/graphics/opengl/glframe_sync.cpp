@@ -0,0 +1,41 @@
+#include "graphics/detail/loggers.h"
+#include "glframe_sync.h"
+
+using namespace phenyl::graphics;
+
+static phenyl::Logger LOGGER{"GL_FRAME_SYNC", detail::GRAPHICS_LOGGER};
+
+// 1 second
+#define FENCE_TIMEOUT 1000000000
+
+GlFrameSync::~GlFrameSync () {
+    for (auto i : fences) {
+        if (i) {
+            glDeleteSync(i);
+        }
+    }
+}
+
+void GlFrameSync::endFrame () {
+    // Fences are consumed when their slot is waited on
+    PHENYL_DASSERT(!fences[slot()]);
+    fences[slot()] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    frame++;
+    auto& nextFence = fences[slot()];
+    if (!nextFence) {
+        return;
+    }
+
+    GLenum result;
+    while ((result = glClientWaitSync(nextFence, GL_SYNC_FLUSH_COMMANDS_BIT, FENCE_TIMEOUT)) == GL_TIMEOUT_EXPIRED) {
+        PHENYL_LOGW(LOGGER, "Timed out waiting for frame slot {}, waiting again", slot());
+    }
+
+    if (result == GL_WAIT_FAILED) {
+        PHENYL_LOGE(LOGGER, "Failed to wait on fence of frame slot {}", slot());
+    }
+
+    glDeleteSync(nextFence);
+    nextFence = nullptr;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <array>
+
+#include "graphics/graphics_headers.h"
+
+namespace phenyl::graphics {
+    // Tracks the frames the CPU may write ahead of the GPU. Streamed buffers keep one slot of storage per frame in
+    // flight and write to the slot of the current frame, which the GPU is guaranteed to have finished reading.
+    class GlFrameSync {
+    public:
+        static constexpr std::size_t FRAMES_IN_FLIGHT = 3;
+    private:
+        std::array<GLsync, FRAMES_IN_FLIGHT> fences{};
+        std::size_t frame = 0;
+    public:
+        GlFrameSync () = default;
+        GlFrameSync (const GlFrameSync&) = delete;
+        GlFrameSync& operator= (const GlFrameSync&) = delete;
+
+        ~GlFrameSync ();
+
+        [[nodiscard]] std::size_t slot () const noexcept {
+            return frame % FRAMES_IN_FLIGHT;
+        }
+
+        // Fences the commands of the current frame and waits until the GPU is done with the next frame's slot
+        void endFrame ();
+    };
+}
@@ -15,6 +15,17 @@ static GLint GetGlFilter (TextureFilter filter) {
     PHENYL_ABORT("Invalid filter type: {}", (unsigned int)filter);
 }
 
+static GLint GetGlWrap (TextureWrap wrap) {
+    switch (wrap) {
+        case TextureWrap::REPEAT:
+            return GL_REPEAT;
+        case TextureWrap::CLAMP:
+            return GL_CLAMP_TO_EDGE;
+    }
+
+    PHENYL_ABORT("Invalid wrap type: {}", static_cast<unsigned int>(wrap));
+}
+
 static GLint GetGlFormat (ImageFormat format) {
     switch (format) {
         case ImageFormat::R:
@@ -40,6 +51,8 @@ GlImageTexture::GlImageTexture (const TextureProperties& properties) : texSample
     texSampler.bind();
     glTexParameteri(texSampler.type(), GL_TEXTURE_MIN_FILTER, GetGlFilter(properties.filter));
     glTexParameteri(texSampler.type(), GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(texSampler.type(), GL_TEXTURE_WRAP_S, GetGlWrap(properties.wrap));
+    glTexParameteri(texSampler.type(), GL_TEXTURE_WRAP_T, GetGlWrap(properties.wrap));
 }
 
 void GlImageTexture::upload (const Image& image) {
@@ -56,6 +69,28 @@ void GlImageTexture::upload (const Image& image) {
     texHeight = image.height();
 }
 
+void GlImageTexture::allocate (std::uint32_t width, std::uint32_t height) {
+    texSampler.bind();
+
+    glTexImage2D(texSampler.type(), 0, GetGlFormat(texSampler.properties().format), static_cast<GLsizei>(width), static_cast<GLsizei>(height), 0, GetGlFormat(texSampler.properties().format),
+                 GetGlFormatType(texSampler.properties().format), nullptr);
+
+    texWidth = width;
+    texHeight = height;
+}
+
+void GlImageTexture::uploadRegion (const Image& image, glm::uvec2 offset) {
+    PHENYL_DASSERT(offset.x + image.width() <= texWidth && offset.y + image.height() <= texHeight);
+
+    glTextureSubImage2D(texSampler.id(), 0, static_cast<GLint>(offset.x), static_cast<GLint>(offset.y), static_cast<GLsizei>(image.width()), static_cast<GLsizei>(image.height()),
+                        GetGlFormat(image.format()), GetGlFormatType(image.format()), image.data().data());
+
+    if (texSampler.properties().useMipmapping) {
+        texSampler.bind();
+        glGenerateMipmap(GL_TEXTURE_2D);
+    }
+}
+
 std::uint32_t GlImageTexture::width () const noexcept {
     return texWidth;
 }
@@ -17,6 +17,8 @@ namespace phenyl::graphics {
         [[nodiscard]] std::uint32_t height () const noexcept override;
 
         void upload (const phenyl::graphics::Image& image) override;
+        void allocate (std::uint32_t width, std::uint32_t height) override;
+        void uploadRegion (const Image& image, glm::uvec2 offset) override;
         const ISampler& sampler() const noexcept override;
     };
 }
\ No newline at end of file
@@ -7,12 +7,13 @@ using namespace phenyl::graphics;
 
 static phenyl::Logger LOGGER{"GL_PIPELINE"};
 
-GlPipeline::GlPipeline () : vaoId{0} {
+GlPipeline::GlPipeline (GlStateCache& stateCache) : stateCache{&stateCache}, vaoId{0} {
     glCreateVertexArrays(1, &vaoId);
 }
 
 
-GlPipeline::GlPipeline (GlPipeline&& other) noexcept : vaoId{other.vaoId}, bufferTypes{std::move(other.bufferTypes)}, uniformTypes{std::move(other.uniformTypes)} {
+GlPipeline::GlPipeline (GlPipeline&& other) noexcept : stateCache{other.stateCache}, vaoId{other.vaoId}, bufferTypes{std::move(other.bufferTypes)}, uniformTypes{std::move(other.uniformTypes)},
+        vertexBindings{std::move(other.vertexBindings)}, indexBuffer{other.indexBuffer}, boundIndexId{other.boundIndexId}, bindingsEpoch{other.bindingsEpoch} {
     other.vaoId = 0;
 }
 
@@ -21,9 +22,14 @@ GlPipeline& GlPipeline::operator= (GlPipeline&& other) noexcept {
         glDeleteVertexArrays(1, &vaoId);
     }
 
+    stateCache = other.stateCache;
     vaoId = other.vaoId;
     bufferTypes = std::move(other.bufferTypes);
     uniformTypes = std::move(other.uniformTypes);
+    vertexBindings = std::move(other.vertexBindings);
+    indexBuffer = other.indexBuffer;
+    boundIndexId = other.boundIndexId;
+    bindingsEpoch = other.bindingsEpoch;
 
     other.vaoId = 0;
 
@@ -41,7 +47,8 @@ void GlPipeline::bindBuffer (std::size_t type, BufferBinding binding, IBuffer& b
     PHENYL_DASSERT_MSG(type == bufferTypes[binding], "Attempted to bind buffer to binding {} with invalid type", binding);
     auto& glBuffer = reinterpret_cast<GlBuffer&>(buffer);
 
-    glVertexArrayVertexBuffer(vaoId, binding, glBuffer.id(), 0, static_cast<GLsizei>(glBuffer.elementSize()));
+    vertexBindings[binding].streamedBuffer = glBuffer.isStreamed() ? &glBuffer : nullptr;
+    applyVertexBuffer(binding, glBuffer);
 }
 
 void GlPipeline::bindUniform (std::size_t type, UniformBinding binding, IUniformBuffer& buffer) {
@@ -50,7 +57,7 @@ void GlPipeline::bindUniform (std::size_t type, UniformBinding binding, IUniform
 
     auto& glBuffer = reinterpret_cast<GlUniformBuffer&>(buffer);
 
-    glBindBufferBase(GL_UNIFORM_BUFFER, binding, glBuffer.id());
+    stateCache->bindUniformBuffer(binding, glBuffer.id());
 }
 
 void GlPipeline::bindIndexBuffer (ShaderIndexType type, IBuffer& buffer) {
@@ -77,34 +84,95 @@ void GlPipeline::bindIndexBuffer (ShaderIndexType type, IBuffer& buffer) {
             PHENYL_ABORT("Invalid shader index type: {}", static_cast<unsigned int>(type));
     }
 
-    auto& glBuffer = reinterpret_cast<GlBuffer&>(buffer);
-    glVertexArrayElementBuffer(vaoId, glBuffer.id());
+    indexBuffer = &reinterpret_cast<GlBuffer&>(buffer);
+    applyIndexBuffer();
 }
 
 void GlPipeline::bindSampler (SamplerBinding binding, const ISampler& sampler) {
     const auto& glSampler = reinterpret_cast<const GlSampler&>(sampler);
-    glActiveTexture(binding);
-    glSampler.bind();
+    stateCache->bindTexture(binding - GL_TEXTURE0, glSampler.type(), glSampler.id());
 }
 
 void GlPipeline::unbindIndexBuffer () {
-    glVertexArrayElementBuffer(vaoId, 0);
     indexType = std::nullopt;
+    indexBuffer = nullptr;
+    applyIndexBuffer();
 }
 
-void GlPipeline::render (std::size_t vertices, std::size_t offset) {
+void GlPipeline::syncEpoch () {
+    if (bindingsEpoch != stateCache->epoch()) {
+        // Buffers may have been deleted and their names reused since the state was recorded
+        for (auto& i : vertexBindings) {
+            i.boundId = 0;
+        }
+        boundIndexId = std::nullopt;
+        bindingsEpoch = stateCache->epoch();
+    }
+}
+
+void GlPipeline::applyVertexBuffer (BufferBinding binding, const GlBuffer& buffer) {
+    syncEpoch();
+
+    auto& vertexBinding = vertexBindings[binding];
+    if (vertexBinding.boundId != buffer.id() || vertexBinding.boundOffset != buffer.offset()) {
+        glVertexArrayVertexBuffer(vaoId, binding, buffer.id(), static_cast<GLintptr>(buffer.offset()), static_cast<GLsizei>(buffer.elementSize()));
+        vertexBinding.boundId = buffer.id();
+        vertexBinding.boundOffset = buffer.offset();
+    }
+}
+
+void GlPipeline::applyIndexBuffer () {
+    syncEpoch();
+
+    // The offset into the index buffer is passed with each draw, so only the buffer itself is attached
+    auto indexId = indexBuffer ? indexBuffer->id() : 0;
+    if (boundIndexId != indexId) {
+        glVertexArrayElementBuffer(vaoId, indexId);
+        boundIndexId = indexId;
+    }
+}
+
+void GlPipeline::prepareDraw () {
     PHENYL_DASSERT(shader);
 
-    getShader().bind();
-    glBindVertexArray(vaoId);
+    stateCache->useProgram(getShader().id());
+
+    for (BufferBinding binding = 0; binding < vertexBindings.size(); binding++) {
+        if (vertexBindings[binding].streamedBuffer) {
+            applyVertexBuffer(binding, *vertexBindings[binding].streamedBuffer);
+        }
+    }
+    if (indexBuffer && indexBuffer->isStreamed()) {
+        applyIndexBuffer();
+    }
+
+    stateCache->bindVertexArray(vaoId);
+}
+
+std::size_t GlPipeline::indexOffset () const {
+    return indexBuffer ? indexBuffer->offset() : 0;
+}
+
+void GlPipeline::render (std::size_t vertices, std::size_t offset) {
+    prepareDraw();
 
     if (indexType) {
-        glDrawElements(renderMode, static_cast<GLsizei>(vertices), indexType->typeEnum, reinterpret_cast<void*>(offset * indexType->typeSize));
+        glDrawElements(renderMode, static_cast<GLsizei>(vertices), indexType->typeEnum, reinterpret_cast<void*>(indexOffset() + offset * indexType->typeSize));
     } else {
         glDrawArrays(renderMode, static_cast<GLsizei>(offset), static_cast<GLsizei>(vertices));
     }
 }
 
+void GlPipeline::renderInstanced (std::size_t numInstances, std::size_t vertices, std::size_t offset) {
+    prepareDraw();
+
+    if (indexType) {
+        glDrawElementsInstancedBaseInstance(renderMode, static_cast<GLsizei>(vertices), indexType->typeEnum, reinterpret_cast<void*>(indexOffset()), static_cast<GLsizei>(numInstances), static_cast<GLuint>(offset));
+    } else {
+        glDrawArraysInstancedBaseInstance(renderMode, 0, static_cast<GLsizei>(vertices), static_cast<GLsizei>(numInstances), static_cast<GLuint>(offset));
+    }
+}
+
 void GlPipeline::setRenderMode (GLenum renderMode) {
     this->renderMode = renderMode;
 }
@@ -118,6 +186,7 @@ BufferBinding GlPipeline::addBuffer (std::size_t type, GLuint divisor) {
 
     auto nextBinding = static_cast<BufferBinding>(bufferTypes.size());
     bufferTypes.emplace_back(type);
+    vertexBindings.emplace_back();
 
     glVertexArrayBindingDivisor(vaoId, nextBinding, divisor);
 
@@ -139,25 +208,16 @@ UniformBinding GlPipeline::addUniform (std::size_t type, unsigned int location)
 }
 
 SamplerBinding GlPipeline::addSampler (unsigned int location) {
+    PHENYL_ASSERT_MSG(location != GlSampler::UPDATE_UNIT, "Sampler location {} is reserved for texture updates", location);
     return GL_TEXTURE0 + location;
 }
 
-GLuint GlPipeline::getCurrDivisor () const {
-    if (renderMode == GL_TRIANGLES) {
-        return 3;
-    } else if (renderMode == GL_LINES) {
-        return 2;
-    } else {
-        return 0;
-    }
-}
-
 GlShader& GlPipeline::getShader () {
     PHENYL_ASSERT(shader);
     return static_cast<GlShader&>(shader->getUnderlying());
 }
 
-GlPipelineBuilder::GlPipelineBuilder () : pipeline(std::make_unique<GlPipeline>()) {}
+GlPipelineBuilder::GlPipelineBuilder (GlStateCache& stateCache) : pipeline(std::make_unique<GlPipeline>(stateCache)) {}
 
 void GlPipelineBuilder::withGeometryType (GeometryType type) {
     PHENYL_DASSERT(pipeline);
@@ -179,7 +239,8 @@ void GlPipelineBuilder::withShader (core::Asset<Shader> shader) {
 
 BufferBinding GlPipelineBuilder::withBuffer (std::size_t type, std::size_t size, BufferInputRate inputRate) {
     PHENYL_DASSERT(pipeline);
-    GLuint divisor = inputRate == BufferInputRate::INSTANCE ? pipeline->getCurrDivisor() : 0;
+    // Instance rate buffers advance once per instance
+    GLuint divisor = inputRate == BufferInputRate::INSTANCE ? 1 : 0;
 
     return pipeline->addBuffer(type, divisor);
 }
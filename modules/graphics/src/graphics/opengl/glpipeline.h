@@ -5,7 +5,9 @@
 #include "graphics/pipeline.h"
 #include "graphics/graphics_headers.h"
 #include "graphics/shader.h"
+#include "glbuffer.h"
 #include "glshader.h"
+#include "glstate_cache.h"
 
 namespace phenyl::graphics {
     class GlPipeline : public IPipeline {
@@ -15,6 +17,13 @@ namespace phenyl::graphics {
             std::size_t typeSize;
         };
 
+        struct VertexBinding {
+            GlBuffer* streamedBuffer = nullptr;
+            GLuint boundId = 0;
+            std::size_t boundOffset = 0;
+        };
+
+        GlStateCache* stateCache;
         GLuint vaoId;
         GLenum renderMode = GL_TRIANGLES;
         core::Asset<Shader> shader;
@@ -22,9 +31,21 @@ namespace phenyl::graphics {
         util::Map<UniformBinding, std::size_t> uniformTypes;
         std::optional<PipelineIndex> indexType = std::nullopt;
 
+        // What is attached to the vertex array, so attaching the same buffer at the same offset again is skipped.
+        // Streamed buffers move to a new offset every frame and are reapplied before each draw.
+        std::vector<VertexBinding> vertexBindings;
+        GlBuffer* indexBuffer = nullptr;
+        std::optional<GLuint> boundIndexId = std::nullopt;
+        std::uint64_t bindingsEpoch = 0;
+
         GlShader& getShader ();
+        void syncEpoch ();
+        void applyVertexBuffer (BufferBinding binding, const GlBuffer& buffer);
+        void applyIndexBuffer ();
+        void prepareDraw ();
+        [[nodiscard]] std::size_t indexOffset () const;
     public:
-        explicit GlPipeline ();
+        explicit GlPipeline (GlStateCache& stateCache);
         GlPipeline (const GlPipeline&) = delete;
         GlPipeline (GlPipeline&& other) noexcept;
 
@@ -40,6 +61,7 @@ namespace phenyl::graphics {
         void unbindIndexBuffer () override;
 
         void render (std::size_t vertices, std::size_t offset) override;
+        void renderInstanced (std::size_t numInstances, std::size_t vertices, std::size_t offset) override;
 
         void setRenderMode (GLenum renderMode);
         void setShader (core::Asset<Shader> shader);
@@ -49,15 +71,13 @@ namespace phenyl::graphics {
 
         UniformBinding addUniform (std::size_t type, unsigned int location);
         SamplerBinding addSampler (unsigned int location);
-
-        GLuint getCurrDivisor () const;
     };
 
     class GlPipelineBuilder : public IPipelineBuilder {
     private:
         std::unique_ptr<GlPipeline> pipeline;
     public:
-        GlPipelineBuilder ();
+        explicit GlPipelineBuilder (GlStateCache& stateCache);
 
         void withGeometryType (GeometryType type) override;
         void withShader (core::Asset<Shader> shader) override;
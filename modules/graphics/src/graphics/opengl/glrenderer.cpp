@@ -122,12 +122,16 @@ void GLRenderer::setupErrorHandling () {
     }, nullptr);
 }
 
-std::unique_ptr<IBuffer> GLRenderer::makeRendererBuffer (std::size_t startCapacity, std::size_t elementSize) {
+std::unique_ptr<IBuffer> GLRenderer::makeRendererBuffer (std::size_t startCapacity, std::size_t elementSize, BufferStorage storage) {
+    if (storage == BufferStorage::STREAMED) {
+        return std::make_unique<GlBuffer>(startCapacity, elementSize, frameSync);
+    }
+
     return std::make_unique<GlBuffer>(startCapacity, elementSize);
 }
 
 PipelineBuilder GLRenderer::buildPipeline () {
-    return PipelineBuilder(std::make_unique<GlPipelineBuilder>());
+    return PipelineBuilder(std::make_unique<GlPipelineBuilder>(stateCache));
 }
 
 std::unique_ptr<IUniformBuffer> GLRenderer::makeRendererUniformBuffer (bool readable) {
@@ -199,9 +203,13 @@ std::unique_ptr<GLRenderer> GLRenderer::Make (const GraphicsProperties& properti
 }
 
 void GLRenderer::render () {
+    stateCache.invalidate();
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     layerRender();
     viewport->swapBuffers();
+
+    // Streamed buffers written from here on go to the next frame's storage
+    frameSync.endFrame();
 }
 
 std::unique_ptr<IImageTexture> GLRenderer::makeRendererImageTexture (const TextureProperties& properties) {
@@ -6,6 +6,8 @@
 #include "graphics/graphics_headers.h"
 #include "graphics/renderer.h"
 
+#include "glframe_sync.h"
+#include "glstate_cache.h"
 #include "glshader.h"
 #include "graphics/glfw/glfw_viewport.h"
 
@@ -16,6 +18,8 @@ namespace phenyl::graphics {
         std::unique_ptr<GLFWViewport> viewport;
 
         GlShaderManager shaderManager;
+        GlFrameSync frameSync;
+        GlStateCache stateCache;
 
         core::Asset<Shader> boxShader;
         core::Asset<Shader> debugShader;
@@ -23,7 +27,7 @@ namespace phenyl::graphics {
         core::Asset<Shader> textShader;
         core::Asset<Shader> particleShader;
     protected:
-        std::unique_ptr<IBuffer> makeRendererBuffer (std::size_t startCapacity, std::size_t elementSize) override;
+        std::unique_ptr<IBuffer> makeRendererBuffer (std::size_t startCapacity, std::size_t elementSize, BufferStorage storage) override;
         std::unique_ptr<IUniformBuffer> makeRendererUniformBuffer (bool readable) override;
         std::unique_ptr<IImageTexture> makeRendererImageTexture (const TextureProperties& properties) override;
         std::unique_ptr<IImageArrayTexture> makeRendererArrayTexture(const TextureProperties &properties, std::uint32_t width, std::uint32_t height) override;
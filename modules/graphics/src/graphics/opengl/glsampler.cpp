@@ -34,5 +34,6 @@ std::size_t GlSampler::hash () const noexcept {
 }
 
 void GlSampler::bind () const {
+    glActiveTexture(GL_TEXTURE0 + UPDATE_UNIT);
     glBindTexture(samplerType, textureId);
 }
\ No newline at end of file
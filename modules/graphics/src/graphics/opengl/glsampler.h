@@ -5,6 +5,10 @@
 
 namespace phenyl::graphics {
     class GlSampler : public ISampler {
+    public:
+        // Texture unit used for creating and updating textures. Pipelines never sample from it, so updates do not
+        // disturb the bindings tracked by GlStateCache.
+        static constexpr GLuint UPDATE_UNIT = 15;
     protected:
         GLuint textureId{0};
         GLenum samplerType;
@@ -33,6 +37,7 @@ namespace phenyl::graphics {
             return samplerType;
         }
 
+        // Binds to UPDATE_UNIT for modification
         void bind () const;
     };
 }
\ No newline at end of file
@@ -107,7 +107,6 @@ bool GlShader::addUniformBlock (const std::string& uniform) {
         return false;
     }
 
-    bind();
     glUniformBlockBinding(programId, blockIndex, location);
     uniformBlocks[uniform] = location;
     return true;
@@ -125,8 +124,7 @@ bool GlShader::addSampler (const std::string& sampler) {
         return false;
     }
 
-    bind();
-    glUniform1i(samplerUniform, static_cast<GLint>(samplerId));
+    glProgramUniform1i(programId, samplerUniform, static_cast<GLint>(samplerId));
     samplers[sampler] = samplerId;
     return true;
 }
@@ -145,10 +143,6 @@ std::optional<unsigned int> GlShader::getSamplerLocation (const std::string& sam
     return samplerIt != samplers.end() ? std::optional{samplerIt->second} : std::nullopt;
 }
 
-void GlShader::bind () {
-    glUseProgram(programId);
-}
-
 const char* GlShaderManager::getFileType () const {
     return ".json";
 }
@@ -49,7 +49,9 @@ namespace phenyl::graphics {
         std::optional<unsigned int> getUniformLocation (const std::string& uniform) const noexcept override;
         std::optional<unsigned int> getSamplerLocation (const std::string& sampler) const noexcept override;
 
-        void bind ();
+        [[nodiscard]] GLuint id () const noexcept {
+            return programId;
+        }
     };
 
     class GlShaderManager : public core::AssetManager<Shader> {
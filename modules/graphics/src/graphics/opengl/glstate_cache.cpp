@@ -0,0 +1,50 @@
+#include "glstate_cache.h"
+
+using namespace phenyl::graphics;
+
+void GlStateCache::useProgram (GLuint programId) {
+    if (program != programId) {
+        glUseProgram(programId);
+        program = programId;
+    }
+}
+
+void GlStateCache::bindVertexArray (GLuint vaoId) {
+    if (vertexArray != vaoId) {
+        glBindVertexArray(vaoId);
+        vertexArray = vaoId;
+    }
+}
+
+void GlStateCache::bindTexture (GLuint unit, GLenum target, GLuint textureId) {
+    if (unit >= textures.size()) {
+        textures.resize(unit + 1);
+    }
+
+    auto& binding = textures[unit];
+    if (binding.target != target || binding.id != textureId) {
+        // The active unit is not tracked, as texture updates switch it behind the cache's back
+        glActiveTexture(GL_TEXTURE0 + unit);
+        glBindTexture(target, textureId);
+        binding = TextureBinding{.target = target, .id = textureId};
+    }
+}
+
+void GlStateCache::bindUniformBuffer (GLuint binding, GLuint bufferId) {
+    if (binding >= uniformBuffers.size()) {
+        uniformBuffers.resize(binding + 1);
+    }
+
+    if (uniformBuffers[binding] != bufferId) {
+        glBindBufferBase(GL_UNIFORM_BUFFER, binding, bufferId);
+        uniformBuffers[binding] = bufferId;
+    }
+}
+
+void GlStateCache::invalidate () {
+    currEpoch++;
+    program = 0;
+    vertexArray = 0;
+    textures.clear();
+    uniformBuffers.clear();
+}
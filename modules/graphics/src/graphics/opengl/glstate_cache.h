@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "graphics/graphics_headers.h"
+
+namespace phenyl::graphics {
+    // Mirrors the context state that draws depend on, so that binding what is already bound costs no GL call. All
+    // binds of programs, vertex arrays, sampled textures and uniform buffers made while rendering go through here.
+    class GlStateCache {
+    private:
+        struct TextureBinding {
+            GLenum target = 0;
+            GLuint id = 0;
+        };
+
+        std::uint64_t currEpoch = 0;
+        GLuint program = 0;
+        GLuint vertexArray = 0;
+        std::vector<TextureBinding> textures;
+        std::vector<GLuint> uniformBuffers;
+    public:
+        void useProgram (GLuint programId);
+        void bindVertexArray (GLuint vaoId);
+        void bindTexture (GLuint unit, GLenum target, GLuint textureId);
+        void bindUniformBuffer (GLuint binding, GLuint bufferId);
+
+        // Forgets all tracked state. Called at the start of every frame, as objects deleted since may have had their
+        // names reused. Objects must not be deleted while rendering.
+        void invalidate ();
+
+        // Changes on every invalidate(), for state tracked outside the cache
+        [[nodiscard]] std::uint64_t epoch () const noexcept {
+            return currEpoch;
+        }
+    };
+}
@@ -39,13 +39,17 @@ void phenyl::graphics::ParticleManager2D::update (float deltaTime) {
     }
 }
 
-void phenyl::graphics::ParticleManager2D::buffer (phenyl::graphics::Buffer<glm::vec2>& posBuffer, phenyl::graphics::Buffer<glm::vec4>& colourBuffer) const {
+void phenyl::graphics::ParticleManager2D::buffer (phenyl::graphics::Buffer<glm::vec2>& posBuffer, phenyl::graphics::Buffer<glm::vec4>& colourBuffer, const Bounds2D& viewBounds) const {
     for (auto [_, system] : systems.kv()) {
-        system->bufferPos(posBuffer);
+        if (system->bounds().intersects(viewBounds)) {
+            system->bufferPos(posBuffer);
+        }
     }
 
     for (auto [_, system] : systems.kv()) {
-        system->bufferColour(colourBuffer);
+        if (system->bounds().intersects(viewBounds)) {
+            system->bufferColour(colourBuffer);
+        }
     }
 }
 
@@ -32,6 +32,9 @@ using namespace phenyl::graphics;
 
 static phenyl::Logger LOGGER{"PARTICLE_SYSTEM2D", detail::GRAPHICS_LOGGER};
 
+// Distance from the centre of a particle quad to its corners, relative to its size
+static constexpr float PARTICLE_RADIUS = std::numbers::sqrt2_v<float>;
+
 ParticleSystem2D::ParticleSystem2D (ParticleProperties2D properties, std::size_t maxParticles) : properties{properties}, particles{maxParticles}, startIndex{0}, size{0}, activeNum{0} {}
 
 void ParticleSystem2D::emit (glm::vec2 worldPos, glm::vec2 direction) {
@@ -84,11 +87,13 @@ void ParticleSystem2D::addParticle (glm::vec2 worldPos, glm::vec2 direction, std
     particle.angularVel = util::Random::Rand(properties.angularVelMin, properties.angularVelMax) / 180 * std::numbers::pi_v<float>;
 
     particle.active = true;
+    particleBounds.extend(particle.pos, glm::abs(particle.size) * PARTICLE_RADIUS);
 }
 
 void ParticleSystem2D::update (float deltaTime) {
     auto beginSize = size;
     auto beginIndex = startIndex;
+    particleBounds = Bounds2D{};
     for (std::size_t i = 0; i < beginSize; i++) {
         auto index = (beginIndex + i) % particles.size();
 
@@ -120,6 +125,8 @@ void ParticleSystem2D::update (float deltaTime) {
 
         particle.colour = (particle.colourEnd - particle.colourStart) * (particle.lifetime - particle.remainingTime) / particle.lifetime + particle.colourStart;
         particle.size = (particle.sizeEnd - particle.sizeStart) * (particle.lifetime - particle.remainingTime) / particle.lifetime + particle.sizeStart;
+
+        particleBounds.extend(particle.pos, glm::abs(particle.size) * PARTICLE_RADIUS);
     }
 }
 
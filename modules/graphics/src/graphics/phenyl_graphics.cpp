@@ -4,6 +4,7 @@
 #include "graphics/phenyl_graphics.h"
 #include "graphics/glfw/glfw_viewport.h"
 #include "graphics/opengl/glrenderer.h"
+#include "graphics/null/null_renderer.h"
 
 using namespace phenyl::graphics;
 
@@ -11,7 +12,6 @@ std::unique_ptr<Renderer> phenyl::graphics::MakeGLRenderer (const phenyl::graphi
     return GLRenderer::Make(properties);
 }
 
-
-
-
-
+std::unique_ptr<Renderer> phenyl::graphics::MakeNullRenderer (const phenyl::graphics::GraphicsProperties& properties, RenderCommandLog* log) {
+    return std::make_unique<NullRenderer>(properties, log);
+}
@@ -23,9 +23,9 @@ static void UpdateSystem (const phenyl::core::Resources<const phenyl::core::Delt
     manager.update(static_cast<float>(deltaTime()));
 }
 
-static void RenderSystem (const phenyl::core::Resources<ParticleData, ParticleManager2D>& resources) {
-    auto& [data, manager] = resources;
-    data.layer->bufferData(manager);
+static void RenderSystem (const phenyl::core::Resources<ParticleData, ParticleManager2D, const Camera>& resources) {
+    auto& [data, manager, camera] = resources;
+    data.layer->bufferData(manager, camera);
 }
 
 Particle2DPlugin::Particle2DPlugin () = default;
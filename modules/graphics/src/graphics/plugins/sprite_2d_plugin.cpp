@@ -19,6 +19,7 @@ void Sprite2DPlugin::init (core::PhenylRuntime& runtime) {
     runtime.addPlugin<core::Core2DPlugin>();
 
     runtime.addComponent<Sprite2D>("Sprite2D");
+    runtime.addComponent<StaticSprite2D>("StaticSprite2D");
 
     auto& renderer = runtime.resource<Renderer>();
     entityLayer = &renderer.addLayer<EntityRenderLayer>();
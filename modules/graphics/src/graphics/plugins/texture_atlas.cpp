@@ -0,0 +1,60 @@
+#include "graphics/detail/loggers.h"
+#include "graphics/renderer.h"
+
+#include "texture_atlas.h"
+
+using namespace phenyl::graphics;
+
+static phenyl::Logger LOGGER{"TEXTURE_ATLAS", detail::GRAPHICS_LOGGER};
+
+TextureAtlas::TextureAtlas (Renderer& renderer, std::uint32_t pageSize, std::uint32_t maxImageSize, std::uint32_t padding) : renderer{renderer}, pageSize{pageSize},
+    maxImageSize{std::min(maxImageSize, pageSize)}, padding{padding} {}
+
+bool TextureAtlas::accepts (const Image& image, const TextureProperties& properties) const noexcept {
+    return properties.wrap == TextureWrap::CLAMP && image.format() == ImageFormat::RGBA && image.width() <= maxImageSize && image.height() <= maxImageSize;
+}
+
+AtlasTexture TextureAtlas::place (const Image& image) {
+    PHENYL_DASSERT(image.format() == ImageFormat::RGBA && image.width() <= maxImageSize && image.height() <= maxImageSize);
+
+    for (auto& page : pages) {
+        auto off = page->packer.allocate({image.width(), image.height()});
+        if (off) {
+            return place(*page, image, *off);
+        }
+    }
+
+    auto& page = makePage();
+    auto off = page.packer.allocate({image.width(), image.height()});
+    PHENYL_DASSERT(off);
+    return place(page, image, *off);
+}
+
+TextureAtlas::Page& TextureAtlas::makePage () {
+    // Mipmaps would bleed neighbouring images into each other
+    auto texture = renderer.makeImageTexture(TextureProperties{
+        .format = ImageFormat::RGBA,
+        .filter = TextureFilter::POINT,
+        .useMipmapping = false,
+        .wrap = TextureWrap::CLAMP
+    });
+    texture.allocate(pageSize, pageSize);
+
+    PHENYL_LOGD(LOGGER, "Created atlas page {} ({}x{})", pages.size(), pageSize, pageSize);
+    return *pages.emplace_back(std::make_unique<Page>(Page{
+        .texture = std::move(texture),
+        .packer = ColumnPacker{pageSize, padding}
+    }));
+}
+
+AtlasTexture TextureAtlas::place (Page& page, const Image& image, glm::uvec2 offset) {
+    page.texture.uploadRegion(image, offset);
+
+    auto size = static_cast<float>(pageSize);
+    return AtlasTexture{page.texture, glm::vec4{
+        static_cast<float>(offset.x) / size,
+        static_cast<float>(offset.y) / size,
+        static_cast<float>(offset.x + image.width()) / size,
+        static_cast<float>(offset.y + image.height()) / size
+    }};
+}
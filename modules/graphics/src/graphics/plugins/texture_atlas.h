@@ -0,0 +1,55 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "graphics/font/glyph_atlas.h"
+#include "graphics/texture.h"
+
+namespace phenyl::graphics {
+    class Renderer;
+
+    // Texture occupying a region of an atlas page. Samples through the page, so sprites on the same page can be drawn
+    // together.
+    class AtlasTexture : public Texture {
+    private:
+        const ImageTexture& page;
+        glm::vec4 rect;
+    public:
+        AtlasTexture (const ImageTexture& page, glm::vec4 rect) : Texture{page.hash()}, page{page}, rect{rect} {}
+
+        [[nodiscard]] const ISampler& sampler () const noexcept override {
+            return page.sampler();
+        }
+
+        [[nodiscard]] glm::vec4 uvRect () const noexcept override {
+            return rect;
+        }
+    };
+
+    // Packs small RGBA images into shared pages. Space is never reclaimed, so unloaded textures leave a hole in their
+    // page.
+    class TextureAtlas {
+    private:
+        struct Page {
+            ImageTexture texture;
+            ColumnPacker packer;
+        };
+
+        Renderer& renderer;
+        std::vector<std::unique_ptr<Page>> pages;
+        std::uint32_t pageSize;
+        std::uint32_t maxImageSize;
+        std::uint32_t padding;
+
+        Page& makePage ();
+        AtlasTexture place (Page& page, const Image& image, glm::uvec2 offset);
+    public:
+        TextureAtlas (Renderer& renderer, std::uint32_t pageSize, std::uint32_t maxImageSize, std::uint32_t padding = 1);
+
+        // Only clamped textures are accepted, as sampling outside of their region would read neighbouring images
+        [[nodiscard]] bool accepts (const Image& image, const TextureProperties& properties) const noexcept;
+        AtlasTexture place (const Image& image);
+    };
+}
@@ -6,11 +6,14 @@
 #include "texture_manager.h"
 
 
+#define ATLAS_PAGE_SIZE 2048
+#define ATLAS_MAX_IMAGE_SIZE 256
+
 using namespace phenyl::graphics;
 
 static phenyl::Logger LOGGER{"TEXTURE_MANAGER", detail::GRAPHICS_LOGGER};
 
-TextureManager::TextureManager (Renderer& renderer) : renderer{renderer} {}
+TextureManager::TextureManager (Renderer& renderer) : renderer{renderer}, atlas{renderer, ATLAS_PAGE_SIZE, ATLAS_MAX_IMAGE_SIZE} {}
 
 Texture* TextureManager::load (std::ifstream& data, std::size_t id) {
     PHENYL_DASSERT(!textures.contains(id));
@@ -21,18 +24,33 @@ Texture* TextureManager::load (std::ifstream& data, std::size_t id) {
         return nullptr;
     }
 
+    // Images are loaded clamped, textures that tile are made with TextureWrap::REPEAT and loaded virtually
     TextureProperties properties{
         .format = image.getUnsafe().format(),
         .filter = TextureFilter::POINT,
-        .useMipmapping = true
+        .useMipmapping = true,
+        .wrap = TextureWrap::CLAMP
     };
 
+    // Small images share atlas pages so sprites using them can be batched
+    if (atlas.accepts(image.getUnsafe(), properties)) {
+        textures.emplace(id, std::make_unique<AtlasTexture>(atlas.place(image.getUnsafe())));
+        return textures[id].get();
+    }
+
     textures.emplace(id, std::make_unique<ImageTexture>(renderer.makeTexture(properties, image.getUnsafe())));
     return textures[id].get();
 }
 
 Texture* TextureManager::load (Texture&& obj, std::size_t id) {
-    PHENYL_ABORT("Virtual loading of textures not supported!");
+    PHENYL_DASSERT(!textures.contains(id));
+
+    // Only image textures can be moved into the manager, e.g. ones generated at runtime
+    auto* imageTexture = dynamic_cast<ImageTexture*>(&obj);
+    PHENYL_ASSERT_MSG(imageTexture, "Virtual loading of textures is only supported for image textures!");
+
+    textures.emplace(id, std::make_unique<ImageTexture>(std::move(*imageTexture)));
+    return textures[id].get();
 }
 
 bool TextureManager::isBinary () const {
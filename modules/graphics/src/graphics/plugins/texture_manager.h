@@ -3,12 +3,15 @@
 #include "graphics/texture.h"
 #include "core/assets/asset_manager.h"
 
+#include "texture_atlas.h"
+
 namespace phenyl::graphics {
     class Renderer;
 
     class TextureManager : public core::AssetManager<Texture> {
     private:
         Renderer& renderer;
+        TextureAtlas atlas;
         std::unordered_map<std::size_t, std::unique_ptr<Texture>> textures;
     public:
         TextureManager (Renderer& renderer);
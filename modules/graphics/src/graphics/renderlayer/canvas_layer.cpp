@@ -7,7 +7,7 @@
 
 using namespace phenyl::graphics;
 
-#define BUFFER_SIZE (256 * 4)
+#define STARTING_BUFFER_SIZE (256 * 4)
 #define MITER_LIMIT 2.5f
 
 CanvasRenderLayer::CanvasRenderLayer (GlyphAtlas& glyphAtlas) : AbstractRenderLayer{4}, glyphAtlas{glyphAtlas} {}
@@ -29,8 +29,8 @@ void CanvasRenderLayer::init (Renderer& renderer) {
                        .withUniform<Uniform>(*textShader->uniformLocation("Uniform"), uniformBinding)
                        .build();
 
-    buffer = renderer.makeBuffer<Vertex>(BUFFER_SIZE);
-    indices = renderer.makeBuffer<std::uint16_t>(BUFFER_SIZE);
+    buffer = renderer.makeBuffer<Vertex>(STARTING_BUFFER_SIZE, BufferStorage::STREAMED);
+    indices = renderer.makeBuffer<Index>(STARTING_BUFFER_SIZE * 6 / 4, BufferStorage::STREAMED);
     uniformBuffer = renderer.makeUniformBuffer<Uniform>();
 
     pipeline.bindBuffer(textBinding, buffer);
@@ -100,19 +100,19 @@ void CanvasRenderLayer::renderConvexPoly (std::span<glm::vec2> points, glm::vec4
 
     // Render out in fan from start index
     const glm::vec3 opaque = glyphAtlas.opaque();
-    std::uint16_t startIndex = buffer.emplace(Vertex{
+    Index startIndex = buffer.emplace(Vertex{
         .pos = points[0],
         .uv = opaque,
         .colour = colour
     });
-    std::uint16_t lastIndex = buffer.emplace(Vertex{
+    Index lastIndex = buffer.emplace(Vertex{
         .pos = points[1],
         .uv = opaque,
         .colour = colour
     });
 
     for (std::size_t i = 2; i < points.size(); i++) {
-        std::uint16_t index = buffer.emplace(Vertex{
+        Index index = buffer.emplace(Vertex{
             .pos = points[i],
             .uv = opaque,
             .colour = colour
@@ -135,8 +135,8 @@ void CanvasRenderLayer::renderConvexPolyAA (std::span<glm::vec2> points, glm::ve
     // Render out in fan from start index
     const glm::vec3 opaque = glyphAtlas.opaque();
 
-    std::uint16_t startIndex = 0;
-    std::uint16_t lastIndex = 0;
+    Index startIndex = 0;
+    Index lastIndex = 0;
     for (std::size_t i = 0; i < points.size(); i++) {
         auto prev = points[(i - 1 + points.size()) % points.size()];
         auto curr = points[i];
@@ -146,7 +146,7 @@ void CanvasRenderLayer::renderConvexPolyAA (std::span<glm::vec2> points, glm::ve
         auto n2 = util::SafeNormalize({-(next.y - curr.y), next.x - curr.x});
         auto miter = -util::SafeNormalize(n1 + n2);
 
-        std::uint16_t index = buffer.emplace(Vertex{
+        Index index = buffer.emplace(Vertex{
             .pos = curr - miter * widthAA,
             .uv = opaque,
             .colour = colour
@@ -198,8 +198,8 @@ void CanvasRenderLayer::renderPolyLine (std::span<glm::vec2> points, glm::vec4 c
 
     const auto halfWidth = width / 2.0f;
     const glm::vec3 opaque = glyphAtlas.opaque();
-    std::uint16_t startIndex;
-    std::uint16_t lastIndex;
+    Index startIndex;
+    Index lastIndex;
     for (std::size_t i = 0; i < points.size(); i++) {
         auto curr = points[i];
         auto prev = i != 0 ? points[i - 1] : (closed ? points.back() : curr); // wrap around if closed, otherwise use curr
@@ -211,8 +211,8 @@ void CanvasRenderLayer::renderPolyLine (std::span<glm::vec2> points, glm::vec4 c
         auto miterMult = 1.0f / glm::dot(miter, n1);
         auto miterLen = halfWidth * miterMult;
 
-        std::uint16_t prevIndex;
-        std::uint16_t nextIndex;
+        Index prevIndex;
+        Index nextIndex;
         if (miterMult <= MITER_LIMIT) {
             // Miter small enough, put in
             prevIndex = buffer.emplace(Vertex{
@@ -299,8 +299,8 @@ void CanvasRenderLayer::renderPolyLineAA(std::span<glm::vec2> points, glm::vec4
     const auto halfWidthAA = width >= widthAA ? width / 2.0f + widthAA * 0.5f : widthAA * 0.5f;
     const glm::vec3 opaque = glyphAtlas.opaque();
 
-    std::uint16_t startIndex;
-    std::uint16_t lastIndex;
+    Index startIndex;
+    Index lastIndex;
     for (std::size_t i = 0; i < points.size(); i++) {
         auto curr = points[i];
         auto prev = i != 0 ? points[i - 1] : (closed ? points.back() : curr); // wrap around if closed, otherwise use curr
@@ -313,8 +313,8 @@ void CanvasRenderLayer::renderPolyLineAA(std::span<glm::vec2> points, glm::vec4
         auto miterLen = halfWidth * miterMult;
         auto miterLenAA = halfWidthAA * miterMult;
 
-        std::uint16_t prevIndex;
-        std::uint16_t nextIndex;
+        Index prevIndex;
+        Index nextIndex;
         if (miterMult <= MITER_LIMIT) {
             // Miter small enough, put in
             prevIndex = buffer.emplace(Vertex{
@@ -18,11 +18,14 @@ namespace phenyl::graphics {
             glm::vec4 colour;
         };
 
+        // 32 bit so large amounts of UI and text cannot wrap indices
+        using Index = std::uint32_t;
+
         Pipeline pipeline;
         GlyphAtlas& glyphAtlas;
         SamplerBinding samplerBinding{};
         Buffer<Vertex> buffer;
-        Buffer<std::uint16_t> indices;
+        Buffer<Index> indices;
         UniformBinding uniformBinding;
         UniformBuffer<Uniform> uniformBuffer;
 
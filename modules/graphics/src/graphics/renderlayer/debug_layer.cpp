@@ -53,8 +53,23 @@ namespace phenyl::graphics {
     };
 }
 
-static std::vector<DebugBox> boxes;
-static std::vector<DebugLine> lines;
+// Screen space shapes are always drawn, world space ones only if they overlap the view
+template <std::size_t N>
+static bool IsVisible (const glm::vec3 (&vertices)[N], const Bounds2D& viewBounds) {
+    if (vertices[0].z == 0) {
+        return true;
+    }
+
+    Bounds2D bounds;
+    for (const auto& v : vertices) {
+        bounds.extend(glm::vec2{v});
+    }
+    return bounds.intersects(viewBounds);
+}
+
+// Queued by the thread of the runtime drawing them, and consumed by the same thread when rendering
+static thread_local std::vector<DebugBox> boxes;
+static thread_local std::vector<DebugLine> lines;
 
 DebugLayer::DebugLayer () : AbstractRenderLayer{1} {}
 
@@ -64,10 +79,10 @@ std::string_view DebugLayer::getName () const {
 
 void DebugLayer::init (Renderer& renderer) {
     auto shader = core::Assets::Load<Shader>("phenyl/shaders/debug");
-    boxPos = renderer.makeBuffer<glm::vec3>(STARTING_BUFFER_SIZE);
-    boxColour = renderer.makeBuffer<glm::vec4>(STARTING_BUFFER_SIZE);
-    linePos = renderer.makeBuffer<glm::vec3>(STARTING_BUFFER_SIZE);
-    lineColour = renderer.makeBuffer<glm::vec4>(STARTING_BUFFER_SIZE);
+    boxPos = renderer.makeBuffer<glm::vec3>(STARTING_BUFFER_SIZE, BufferStorage::STREAMED);
+    boxColour = renderer.makeBuffer<glm::vec4>(STARTING_BUFFER_SIZE, BufferStorage::STREAMED);
+    linePos = renderer.makeBuffer<glm::vec3>(STARTING_BUFFER_SIZE, BufferStorage::STREAMED);
+    lineColour = renderer.makeBuffer<glm::vec4>(STARTING_BUFFER_SIZE, BufferStorage::STREAMED);
     uniformBuffer = renderer.makeUniformBuffer<Uniform>();
 
     BufferBinding posBinding;
@@ -105,12 +120,17 @@ void DebugLayer::bufferData (const Camera& camera, glm::vec2 screenSize) {
     linePos.clear();
     lineColour.clear();
 
+    auto viewBounds = camera.getViewBounds2D();
     for (const auto& i : boxes) {
-        bufferBox(i);
+        if (IsVisible(i.vertices, viewBounds)) {
+            bufferBox(i);
+        }
     }
 
     for (const auto& i : lines) {
-        bufferLine(i);
+        if (IsVisible(i.vertices, viewBounds)) {
+            bufferLine(i);
+        }
     }
 
     boxPos.upload();
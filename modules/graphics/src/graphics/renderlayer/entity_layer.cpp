@@ -4,12 +4,90 @@
 #include "graphics/renderer.h"
 #include "graphics/components/2d/sprite.h"
 #include "core/runtime.h"
-
-#define MAX_ENTITIES 512
-#define BUFFER_SIZE (MAX_ENTITIES * 2 * 6)
+#include "core/runtime/thread_pool.h"
+#include "util/radix_sort.h"
+
+#include <algorithm>
+#include <bit>
+#include <iterator>
+#include <limits>
+#include <span>
+
+#define STARTING_BUFFER_SIZE 512
+#define QUAD_VERTICES 6
+// Sprites per extraction chunk before it is worth splitting across threads
+#define EXTRACT_MIN_CHUNK 1024
+// Side of the square world cells static sprites are grouped into
+#define STATIC_REGION_SIZE 4.0f
+// Bits of the sort key holding the material id
+#define MATERIAL_BITS 24
 
 using namespace phenyl::graphics;
 
+static constexpr std::uint32_t NO_INSTANCE = std::numeric_limits<std::uint32_t>::max();
+
+// Maps floats to unsigned integers of the same order
+static std::uint32_t OrderedBits (float f) {
+    auto bits = std::bit_cast<std::uint32_t>(f);
+    return (bits & 0x80000000u) ? ~bits : bits | 0x80000000u;
+}
+
+// 16 bits of layer and the top 24 bits of depth, above 24 bits of material id. The material is filled in by
+// AddMaterials(), so sprites sharing a sampler (e.g. an atlas page) are adjacent within a layer and depth.
+static std::uint64_t SortKey (const Sprite2D& sprite) {
+    auto layer = static_cast<std::uint64_t>(static_cast<std::uint16_t>(sprite.layer) ^ 0x8000u);
+    auto depth = static_cast<std::uint64_t>(OrderedBits(sprite.depth) >> 8);
+
+    return layer << 48 | depth << MATERIAL_BITS;
+}
+
+// Gives each sampler a dense id in the order they are first seen, so different samplers never share a material
+template <typename T>
+static void AddMaterials (std::span<T> entries, std::unordered_map<const ISampler*, std::uint64_t>& materialIds, auto&& getSampler) {
+    materialIds.clear();
+
+    // Neighbouring sprites mostly share a sampler, so most lookups are skipped
+    const ISampler* lastSampler = nullptr;
+    std::uint64_t lastMaterial = 0;
+    for (auto& entry : entries) {
+        const ISampler* sampler = getSampler(entry);
+        if (sampler != lastSampler) {
+            lastSampler = sampler;
+            lastMaterial = materialIds.try_emplace(sampler, materialIds.size()).first->second;
+            PHENYL_DASSERT_MSG(lastMaterial < (std::uint64_t{1} << MATERIAL_BITS), "Too many samplers for the sort key");
+        }
+
+        entry.key |= lastMaterial;
+    }
+}
+
+static std::uint16_t SortLayer (std::uint64_t key) {
+    return static_cast<std::uint16_t>(key >> 48);
+}
+
+// Layer and depth of a sort key, without its material
+static std::uint64_t SortLayerDepth (std::uint64_t key) {
+    return key >> MATERIAL_BITS;
+}
+
+static std::uint64_t CellKey (glm::vec2 pos) {
+    glm::ivec2 cell{glm::floor(pos / STATIC_REGION_SIZE)};
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(cell.x)) << 32) | static_cast<std::uint32_t>(cell.y);
+}
+
+static EntityRenderLayer::Instance MakeInstance (const phenyl::core::GlobalTransform2D& transform, const Sprite2D& sprite) {
+    // Sprite UVs are relative to the texture, which may only cover part of its sampler
+    auto rect = sprite.texture->uvRect();
+    glm::vec2 rectStart{rect.x, rect.y};
+    glm::vec2 rectSize = glm::vec2{rect.z, rect.w} - rectStart;
+
+    return EntityRenderLayer::Instance{
+        .pos = transform.transform2D.position(),
+        .transform = transform.transform2D.getMatrix(),
+        .uvRect = glm::vec4{rectStart + rectSize * sprite.uvStart, rectStart + rectSize * sprite.uvEnd}
+    };
+}
+
 struct EntityRenderData2D : public phenyl::core::IResource {
     explicit EntityRenderData2D (EntityRenderLayer& layer) : layer{layer} {}
 
@@ -20,14 +98,9 @@ struct EntityRenderData2D : public phenyl::core::IResource {
     }
 };
 
-static void PushEntitySystem (const phenyl::core::Resources<EntityRenderData2D>& resources, const phenyl::core::GlobalTransform2D& transform, const Sprite2D& sprite) {
-    auto& [data] = resources;
-    data.layer.pushEntity(transform, sprite);
-}
-
-static void BufferEntitiesSystem (const phenyl::core::Resources<EntityRenderData2D, const Camera>& resources) {
-    auto& [data, camera] = resources;
-    data.layer.bufferEntities(camera);
+static void BufferEntitiesSystem (const phenyl::core::Resources<EntityRenderData2D, const Camera, phenyl::core::ThreadPool>& resources) {
+    auto& [data, camera, threadPool] = resources;
+    data.layer.bufferEntities(camera, threadPool);
 }
 
 EntityRenderLayer::EntityRenderLayer () : AbstractRenderLayer{0} {}
@@ -37,162 +110,334 @@ std::string_view EntityRenderLayer::getName () const {
 }
 
 void EntityRenderLayer::init (Renderer& renderer) {
-    BufferBinding vertexBinding;
+    this->renderer = &renderer;
+
     auto shader = phenyl::core::Assets::Load<Shader>("phenyl/shaders/sprite");
     pipeline = renderer.buildPipeline()
            .withShader(shader)
-           .withBuffer<Vertex>(vertexBinding)
-           .withAttrib<glm::vec2>(0, vertexBinding, offsetof(Vertex, pos))
-           .withAttrib<glm::vec2>(1, vertexBinding, offsetof(Vertex, uv))
+           .withBuffer<Instance>(instanceBinding, BufferInputRate::INSTANCE)
+           .withAttrib<glm::vec2>(0, instanceBinding, offsetof(Instance, pos))
+           .withAttrib<glm::mat2>(1, instanceBinding, offsetof(Instance, transform))
+           .withAttrib<glm::vec4>(3, instanceBinding, offsetof(Instance, uvRect))
            .withUniform<Uniform>(*shader->uniformLocation("Camera"), uniformBinding)
            .withSampler2D(*shader->samplerLocation("textureSampler"), samplerBinding)
            .build();
 
-    vertexBuffer = renderer.makeBuffer<Vertex>(BUFFER_SIZE);
-    indices = renderer.makeBuffer<std::uint16_t>(BUFFER_SIZE);
+    instanceBuffer = renderer.makeBuffer<Instance>(STARTING_BUFFER_SIZE, BufferStorage::STREAMED);
     uniformBuffer = renderer.makeUniformBuffer<Uniform>();
-
-    pipeline.bindIndexBuffer(indices);
-    pipeline.bindBuffer(vertexBinding, vertexBuffer);
 }
 
 void EntityRenderLayer::render () {
     pipeline.bindUniform(uniformBinding, uniformBuffer);
 
-    for (const auto& [off, size, sampler] : samplerRenders) {
-        pipeline.bindSampler(samplerBinding, *sampler);
-        pipeline.render(size, off);
+    Buffer<Instance>* boundBuffer = nullptr;
+    auto draw = [&] (const SamplerRender& render) {
+        if (render.buffer != boundBuffer) {
+            pipeline.bindBuffer(instanceBinding, *render.buffer);
+            boundBuffer = render.buffer;
+        }
+
+        pipeline.bindSampler(samplerBinding, *render.sampler);
+        pipeline.renderInstanced(render.size, QUAD_VERTICES, render.instanceOffset);
+    };
+
+    // Static sprites go under dynamic sprites of the same layer
+    auto staticIt = staticRenders.begin();
+    for (const auto& render : samplerRenders) {
+        for (; staticIt != staticRenders.end() && staticIt->layer <= render.layer; ++staticIt) {
+            draw(*staticIt);
+        }
+        draw(render);
+    }
+    for (; staticIt != staticRenders.end(); ++staticIt) {
+        draw(*staticIt);
     }
 
-    vertexBuffer.clear();
-    indices.clear();
-    samplerStartIndices.clear();
+    instanceBuffer.clear();
     samplerRenders.clear();
+    staticRenders.clear();
 }
 
-void EntityRenderLayer::preRender (phenyl::core::World& world, const Camera& camera) {
-    bufferData(world, camera);
-}
-
-void EntityRenderLayer::pushEntity (const core::GlobalTransform2D& transform, const Sprite2D& sprite) {
-    if (!sprite.texture) {
-        return;
-    }
+void EntityRenderLayer::bufferEntities (const Camera& camera, phenyl::core::ThreadPool& threadPool) {
+    uniformBuffer->camera = camera.getCamMatrix();
 
-    auto startIndex = vertexBuffer.emplace(Vertex{
-        .pos = transform.transform2D.apply({-1.0f, 1.0f}),
-        .uv = sprite.uvStart
-    });
-    vertexBuffer.emplace(Vertex{
-        .pos = transform.transform2D.apply({1.0f, 1.0f}),
-        .uv = glm::vec2{sprite.uvEnd.x, sprite.uvStart.y}
-    });
-    vertexBuffer.emplace(Vertex{
-        .pos = transform.transform2D.apply({1.0f, -1.0f}),
-        .uv = sprite.uvEnd
+    auto viewBounds = camera.getViewBounds2D();
+    updateStaticRegions();
+    bufferStatic(viewBounds);
+
+    auto count = query.size();
+    auto numChunks = std::max(std::min(threadPool.size(), count / EXTRACT_MIN_CHUNK), std::size_t{1});
+    auto forEachChunk = [&] (auto&& fn) {
+        threadPool.parallelFor(numChunks, 1, [&] (std::size_t chunkStart, std::size_t chunkEnd) {
+            for (auto chunk = chunkStart; chunk < chunkEnd; chunk++) {
+                fn(chunk, count * chunk / numChunks, count * (chunk + 1) / numChunks);
+            }
+        });
+    };
+
+    sortEntries.resize(count);
+    sortScratch.resize(count);
+    chunkVisible.assign(numChunks, 0);
+    instancePositions.assign(count, NO_INSTANCE);
+
+    // Each chunk packs its visible sprites at the start of its range, so only those are sorted
+    forEachChunk([&] (std::size_t chunk, std::size_t start, std::size_t end) {
+        auto next = start;
+        query.eachRange(start, end, [&] (std::size_t index, const phenyl::core::GlobalTransform2D& transform, const Sprite2D& sprite) {
+            if (!sprite.texture || !Bounds2D::OfQuad(transform.transform2D.position(), transform.transform2D.getMatrix()).intersects(viewBounds)) {
+                return;
+            }
+
+            sortEntries[next++] = SortEntry{
+                .key = SortKey(sprite),
+                .index = static_cast<std::uint32_t>(index),
+                .sampler = &sprite.texture->sampler()
+            };
+        });
+        chunkVisible[chunk] = static_cast<std::uint32_t>(next - start);
     });
-    vertexBuffer.emplace(Vertex{
-        .pos = transform.transform2D.apply({-1.0f, -1.0f}),
-        .uv = glm::vec2{sprite.uvStart.x, sprite.uvEnd.y}
+
+    std::size_t numVisible = 0;
+    for (std::size_t chunk = 0; chunk < numChunks; chunk++) {
+        auto start = sortEntries.begin() + static_cast<std::ptrdiff_t>(count * chunk / numChunks);
+        std::copy(start, start + chunkVisible[chunk], sortEntries.begin() + static_cast<std::ptrdiff_t>(numVisible));
+        numVisible += chunkVisible[chunk];
+    }
+    sortEntries.resize(numVisible);
+    sortScratch.resize(numVisible);
+    AddMaterials(std::span{sortEntries}, materialIds, [] (const SortEntry& entry) {
+        return entry.sampler;
     });
 
-    samplerStartIndices.emplace_back(&sprite.texture->sampler(), startIndex);
-}
+    util::RadixSort(std::span{sortEntries}, std::span{sortScratch}, [] (const SortEntry& entry) {
+        return entry.key;
+    });
 
-void EntityRenderLayer::bufferEntities (const Camera& camera) {
-    std::sort(samplerStartIndices.begin(), samplerStartIndices.end());
-    std::uint16_t offset = 0;
-    const ISampler* currSampler = nullptr;
-    for (const auto& [sampler, startIndex] : samplerStartIndices) {
-        if (sampler != currSampler) {
+    // Batch runs of the same sampler and layer in sorted order
+    std::uint32_t numInstances = 0;
+    for (const auto& [key, index, sampler] : sortEntries) {
+        if (samplerRenders.empty() || sampler != samplerRenders.back().sampler || SortLayer(key) != samplerRenders.back().layer) {
             samplerRenders.emplace_back(SamplerRender{
-                .indexOffset = offset,
+                .instanceOffset = numInstances,
                 .size = 0,
-                .sampler = sampler
+                .sampler = sampler,
+                .layer = SortLayer(key),
+                .key = key,
+                .buffer = &instanceBuffer
             });
-            currSampler = sampler;
         }
 
-        indices.emplace(startIndex + 0);
-        indices.emplace(startIndex + 1);
-        indices.emplace(startIndex + 2);
+        instancePositions[index] = numInstances++;
+        samplerRenders.back().size++;
+    }
 
-        indices.emplace(startIndex + 0);
-        indices.emplace(startIndex + 2);
-        indices.emplace(startIndex + 3);
+    // Write each sprite once, straight to its sorted position in the buffer
+    auto instances = instanceBuffer.allocate(numInstances);
+    forEachChunk([&] (std::size_t, std::size_t start, std::size_t end) {
+        query.eachRange(start, end, [&] (std::size_t index, const phenyl::core::GlobalTransform2D& transform, const Sprite2D& sprite) {
+            auto pos = instancePositions[index];
+            if (pos == NO_INSTANCE) {
+                return;
+            }
 
-        offset += 6;
-        samplerRenders.back().size += 6;
+            instances[pos] = MakeInstance(transform, sprite);
+        });
+    });
+
+    instanceBuffer.upload();
+}
+
+void EntityRenderLayer::removeStatic (core::EntityId id) {
+    if (id.pos() >= bakedPositions.size() || !bakedPositions[id.pos()]) {
+        return;
     }
 
-    vertexBuffer.upload();
-    indices.upload();
+    auto it = staticCells.find(id.value());
+    if (it == staticCells.end()) {
+        return;
+    }
 
-    uniformBuffer->camera = camera.getCamMatrix();
+    auto& region = staticRegions[it->second];
+    std::erase(region.entities, id);
+    region.dirty = true;
+    staticCells.erase(it);
+    bakedPositions[id.pos()] = false;
 }
 
+void EntityRenderLayer::unbakeStatic (core::Entity entity) {
+    if (!entity.has<StaticSprite2D>()) {
+        return;
+    }
 
-void EntityRenderLayer::bufferData (phenyl::core::World& world, const Camera& camera) {
+    removeStatic(entity.id());
+    pendingStatic.emplace_back(entity.id());
+}
 
-    world.query<phenyl::core::GlobalTransform2D, Sprite2D>().each([&] (const phenyl::core::GlobalTransform2D& transform, const Sprite2D& sprite) {
-        if (!sprite.texture) {
-            return;
+void EntityRenderLayer::updateStaticRegions () {
+    // Sprites still missing their transform or sprite stay pending until they have both
+    std::vector<core::EntityId> waiting;
+    for (auto id : pendingStatic) {
+        if (!world->exists(id) || staticCells.contains(id.value()) || std::ranges::find(waiting, id) != waiting.end()) {
+            continue;
         }
 
-        auto startIndex = vertexBuffer.emplace(Vertex{
-            .pos = transform.transform2D.apply({-1.0f, 1.0f}),
-            .uv = sprite.uvStart
-        });
-        vertexBuffer.emplace(Vertex{
-            .pos = transform.transform2D.apply({1.0f, 1.0f}),
-            .uv = glm::vec2{sprite.uvEnd.x, sprite.uvStart.y}
-        });
-        vertexBuffer.emplace(Vertex{
-            .pos = transform.transform2D.apply({1.0f, -1.0f}),
-            .uv = sprite.uvEnd
-        });
-        vertexBuffer.emplace(Vertex{
-            .pos = transform.transform2D.apply({-1.0f, -1.0f}),
-            .uv = glm::vec2{sprite.uvStart.x, sprite.uvEnd.y}
-        });
+        auto entity = world->entity(id);
+        if (!entity.has<StaticSprite2D>()) {
+            continue;
+        }
+
+        const auto* transform = entity.get<core::GlobalTransform2D>();
+        if (!transform || !entity.has<Sprite2D>()) {
+            waiting.emplace_back(id);
+            continue;
+        }
+
+        auto cell = CellKey(transform->transform2D.position());
+        staticCells.emplace(id.value(), cell);
+        if (id.pos() >= bakedPositions.size()) {
+            bakedPositions.resize(id.pos() + 1);
+        }
+        bakedPositions[id.pos()] = true;
+
+        auto it = staticRegions.find(cell);
+        if (it == staticRegions.end()) {
+            it = staticRegions.emplace(cell, StaticRegion{
+                .cell = cell,
+                .entities = {},
+                .instances = renderer->makeBuffer<Instance>(STARTING_BUFFER_SIZE),
+                .renders = {},
+                .textures = {},
+                .bounds = {},
+                .dirty = true
+            }).first;
+        }
+        it->second.entities.emplace_back(id);
+        it->second.dirty = true;
+    }
+    pendingStatic = std::move(waiting);
+
+    for (auto it = staticRegions.begin(); it != staticRegions.end(); ) {
+        if (it->second.dirty) {
+            rebuildRegion(it->second);
+        }
+
+        if (it->second.entities.empty()) {
+            it = staticRegions.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void EntityRenderLayer::rebuildRegion (StaticRegion& region) {
+    struct Entry {
+        std::uint64_t key;
+        Instance instance;
+        const Sprite2D* sprite;
+        Bounds2D bounds;
+    };
+    std::erase_if(region.entities, [&] (core::EntityId id) {
+        if (world->exists(id)) {
+            return false;
+        }
 
-        samplerStartIndices.emplace_back(&sprite.texture->sampler(), startIndex);
+        staticCells.erase(id.value());
+        return true;
     });
 
-    std::sort(samplerStartIndices.begin(), samplerStartIndices.end());
-    std::uint16_t offset = 0;
-    const ISampler* currSampler = nullptr;
-    for (const auto& [sampler, startIndex] : samplerStartIndices) {
-        if (sampler != currSampler) {
-            samplerRenders.emplace_back(SamplerRender{
-                .indexOffset = offset,
+    std::vector<Entry> entries;
+    entries.reserve(region.entities.size());
+    for (auto id : region.entities) {
+        auto entity = world->entity(id);
+        const auto* transform = entity.get<core::GlobalTransform2D>();
+        const auto* sprite = entity.get<Sprite2D>();
+        if (!transform || !sprite || !sprite->texture) {
+            continue;
+        }
+
+        entries.emplace_back(Entry{
+            .key = SortKey(*sprite),
+            .instance = MakeInstance(*transform, *sprite),
+            .sprite = sprite,
+            .bounds = Bounds2D::OfQuad(transform->transform2D.position(), transform->transform2D.getMatrix())
+        });
+    }
+    std::unordered_map<const ISampler*, std::uint64_t> regionMaterials;
+    AddMaterials(std::span{entries}, regionMaterials, [] (const Entry& entry) {
+        return &entry.sprite->texture->sampler();
+    });
+    std::ranges::stable_sort(entries, {}, &Entry::key);
+
+    region.instances.clear();
+    region.renders.clear();
+    region.textures.clear();
+    region.bounds = Bounds2D{};
+    for (const auto& entry : entries) {
+        const auto* sampler = &entry.sprite->texture->sampler();
+        if (region.renders.empty() || sampler != region.renders.back().sampler || SortLayer(entry.key) != region.renders.back().layer) {
+            region.renders.emplace_back(SamplerRender{
+                .instanceOffset = static_cast<std::uint32_t>(region.instances.size()),
                 .size = 0,
-                .sampler = sampler
+                .sampler = sampler,
+                .layer = SortLayer(entry.key),
+                .key = entry.key,
+                .buffer = &region.instances
             });
-            currSampler = sampler;
+            region.textures.emplace_back(entry.sprite->texture);
         }
 
-        indices.emplace(startIndex + 0);
-        indices.emplace(startIndex + 1);
-        indices.emplace(startIndex + 2);
-
-        indices.emplace(startIndex + 0);
-        indices.emplace(startIndex + 2);
-        indices.emplace(startIndex + 3);
+        region.instances.emplace(entry.instance);
+        region.renders.back().size++;
+        region.bounds.extend(entry.bounds.min);
+        region.bounds.extend(entry.bounds.max);
+    }
+    region.instances.upload();
+    region.dirty = false;
+}
 
-        offset += 6;
-        samplerRenders.back().size += 6;
+void EntityRenderLayer::bufferStatic (const Bounds2D& viewBounds) {
+    // Regions are visited in cell order rather than hash order, so renders that tie draw in the same order every frame
+    visibleRegions.clear();
+    for (const auto& [_, region] : staticRegions) {
+        if (region.bounds.intersects(viewBounds)) {
+            visibleRegions.emplace_back(&region);
+        }
     }
+    std::ranges::sort(visibleRegions, {}, &StaticRegion::cell);
 
-    vertexBuffer.upload();
-    indices.upload();
+    for (const auto* region : visibleRegions) {
+        staticRenders.insert(staticRenders.end(), region->renders.begin(), region->renders.end());
+    }
 
-    uniformBuffer->camera = camera.getCamMatrix();
+    // Batches are ordered by layer and the lowest depth in them, depth order only fully holds within a region
+    std::ranges::stable_sort(staticRenders, {}, [] (const SamplerRender& render) {
+        return SortLayerDepth(render.key);
+    });
 }
 
 void EntityRenderLayer::addSystems (core::PhenylRuntime& runtime) {
     runtime.addResource<EntityRenderData2D>(*this);
+    world = &runtime.world();
+    // The Render stage sees frozen entities too, so plain queries match MakeStageQuery<Render>
+    query = runtime.world().queryWithout<StaticSprite2D, const phenyl::core::GlobalTransform2D, const Sprite2D>();
+
+    runtime.world().addHandler<StaticSprite2D>([this] (const core::OnInsert<StaticSprite2D>&, core::Entity entity) {
+        pendingStatic.emplace_back(entity.id());
+    });
+    runtime.world().addHandler<StaticSprite2D>([this] (const core::OnRemove<StaticSprite2D>&, core::Entity entity) {
+        removeStatic(entity.id());
+    });
+    // Losing the transform or sprite unbakes a static sprite until it gets them back
+    runtime.world().addHandler<Sprite2D>([this] (const core::OnRemove<Sprite2D>&, core::Entity entity) {
+        unbakeStatic(entity);
+    });
+    runtime.world().addHandler<core::GlobalTransform2D>([this] (const core::OnRemove<core::GlobalTransform2D>&, core::Entity entity) {
+        unbakeStatic(entity);
+    });
+    // Destroyed entities and level clears do not raise OnRemove
+    runtime.world().addRemoveHandler([this] (core::EntityId id) {
+        removeStatic(id);
+    });
 
-    runtime.addSystem<phenyl::core::Render>("EntityRender::PushEntity", PushEntitySystem)
-        .runBefore(runtime.addSystem<phenyl::core::Render>("EntityRender::BufferEntities", BufferEntitiesSystem));
+    runtime.addSystem<phenyl::core::Render>("EntityRender::BufferEntities", BufferEntitiesSystem);
 }
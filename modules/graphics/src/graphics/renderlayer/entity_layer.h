@@ -1,56 +1,104 @@
 #pragma once
 
+#include <unordered_map>
+
 #include "core/world.h"
+#include "core/components/2d/global_transform.h"
 
 #include "graphics/abstract_render_layer.h"
 #include "graphics/camera.h"
 #include "graphics/buffer.h"
 #include "graphics/pipeline.h"
-
-namespace phenyl::core {
-    struct GlobalTransform2D;
-}
+#include "graphics/components/2d/sprite.h"
 
 namespace phenyl::core {
     class PhenylRuntime;
+    class ThreadPool;
 }
 
 namespace phenyl::graphics {
-    struct Sprite2D;
-
     class EntityRenderLayer : public AbstractRenderLayer {
     public:
-        struct Vertex {
+        // One per sprite, expanded into a quad by the vertex shader
+        struct Instance {
             glm::vec2 pos;
-            glm::vec2 uv;
+            glm::mat2 transform;
+            glm::vec4 uvRect;
         };
 
         struct SamplerRender {
-            std::uint16_t indexOffset;
-            std::uint16_t size;
+            std::uint32_t instanceOffset;
+            std::uint32_t size;
             const ISampler* sampler;
+            // Layer in sort key order, so static and dynamic sprites can be drawn interleaved by layer
+            std::uint16_t layer;
+            // Sort key of the first sprite of the batch, the lowest in it
+            std::uint64_t key;
+            Buffer<Instance>* buffer;
         };
     private:
         struct Uniform {
             glm::mat4 camera;
         };
 
-        std::vector<std::pair<const ISampler*, std::uint16_t>> samplerStartIndices;
+        // Packed layer, depth and material of a sprite, along with its index in the query
+        struct SortEntry {
+            std::uint64_t key;
+            std::uint32_t index;
+            const ISampler* sampler;
+        };
+
+        // Static sprites of one cell of the world, baked once and rebuilt when one of them is added or removed
+        struct StaticRegion {
+            std::uint64_t cell;
+            std::vector<core::EntityId> entities;
+            Buffer<Instance> instances;
+            std::vector<SamplerRender> renders;
+            // Keeps the samplers of the baked renders alive until the region is rebuilt
+            std::vector<core::Asset<Texture>> textures;
+            Bounds2D bounds;
+            bool dirty = true;
+        };
+
+        core::World* world = nullptr;
+        Renderer* renderer = nullptr;
+
+        core::Query<const core::GlobalTransform2D, const Sprite2D> query;
+        std::vector<SortEntry> sortEntries;
+        std::vector<SortEntry> sortScratch;
+        // Dense material id of each sampler in the current frame
+        std::unordered_map<const ISampler*, std::uint64_t> materialIds;
+        // Number of visible sprites found by each extraction chunk
+        std::vector<std::uint32_t> chunkVisible;
+        // Position of each sprite in the instance buffer, indexed by its index in the query
+        std::vector<std::uint32_t> instancePositions;
         std::vector<SamplerRender> samplerRenders;
 
+        std::unordered_map<std::uint64_t, StaticRegion> staticRegions;
+        // Region of each baked static sprite, by entity id value
+        std::unordered_map<std::size_t, std::uint64_t> staticCells;
+        // Whether the entity at each entity position is baked, checked before staticCells on every entity removal
+        std::vector<bool> bakedPositions;
+        // Static sprites not yet baked, placed once they have both a transform and a sprite
+        std::vector<core::EntityId> pendingStatic;
+        std::vector<SamplerRender> staticRenders;
+        std::vector<const StaticRegion*> visibleRegions;
+
         Pipeline pipeline;
+        BufferBinding instanceBinding{};
 
-        //Buffer<glm::vec2> posBuffer;
-       // Buffer<glm::vec2> uvBuffer;
-        Buffer<Vertex> vertexBuffer;
-        Buffer<std::uint16_t> indices;
+        Buffer<Instance> instanceBuffer;
 
         UniformBinding uniformBinding{};
         UniformBuffer<Uniform> uniformBuffer;
 
         SamplerBinding samplerBinding{};
 
-        void bufferData (core::World& world, const Camera& camera);
+        void removeStatic (core::EntityId id);
+        void unbakeStatic (core::Entity entity);
+        void updateStaticRegions ();
+        void rebuildRegion (StaticRegion& region);
+        void bufferStatic (const Bounds2D& viewBounds);
     public:
 
         EntityRenderLayer ();
@@ -59,11 +107,9 @@ namespace phenyl::graphics {
 
         void init (Renderer& renderer) override;
 
-        void preRender (core::World& world, const Camera& camera);
         void render () override;
 
-        void pushEntity (const core::GlobalTransform2D& transform, const Sprite2D& sprite);
-        void bufferEntities (const Camera& camera);
+        void bufferEntities (const Camera& camera, core::ThreadPool& threadPool);
 
         void addSystems (core::PhenylRuntime& runtime);
     };
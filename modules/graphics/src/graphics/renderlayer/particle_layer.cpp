@@ -30,8 +30,8 @@ void ParticleRenderLayer::init (Renderer& renderer) {
                        .build();
 
 
-    posBuffer = renderer.makeBuffer<glm::vec2>(MAX_VERTICES);
-    colourBuffer = renderer.makeBuffer<glm::vec4>(MAX_VERTICES);
+    posBuffer = renderer.makeBuffer<glm::vec2>(MAX_VERTICES, BufferStorage::STREAMED);
+    colourBuffer = renderer.makeBuffer<glm::vec4>(MAX_VERTICES, BufferStorage::STREAMED);
     uniformBuffer = renderer.makeUniformBuffer<Uniform>();
 
     pipeline.bindBuffer(posBinding, posBuffer);
@@ -39,14 +39,16 @@ void ParticleRenderLayer::init (Renderer& renderer) {
     pipeline.bindUniform(uniformBinding, uniformBuffer);
 }
 
-void ParticleRenderLayer::bufferData (const ParticleManager2D& manager) {
+void ParticleRenderLayer::bufferData (const ParticleManager2D& manager, const Camera& camera) {
     posBuffer.clear();
     colourBuffer.clear();
 
-    manager.buffer(posBuffer, colourBuffer);
+    manager.buffer(posBuffer, colourBuffer, camera.getViewBounds2D());
 
     posBuffer.upload();
     colourBuffer.upload();
+
+    uniformBuffer->camera = camera.getCamMatrix();
 }
 
 void ParticleRenderLayer::render () {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "graphics/abstract_render_layer.h"
+#include "graphics/camera.h"
 #include "graphics/renderer.h"
 
 namespace phenyl::graphics {
@@ -23,6 +24,6 @@ namespace phenyl::graphics {
         void init (Renderer& renderer) override;
         void render () override;
 
-        void bufferData (const ParticleManager2D& manager);
+        void bufferData (const ParticleManager2D& manager, const Camera& camera);
     };
 }
\ No newline at end of file
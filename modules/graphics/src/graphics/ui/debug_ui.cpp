@@ -44,6 +44,9 @@ void graphics::ProfileUiPlugin::render (core::PhenylRuntime& runtime) {
     canvas.renderText(glm::vec2{5, 15}, canvas.defaultFont(), 11, "physics: " + std::to_string(physicsQueue.getSmoothed() * 1000) + "ms");
     canvas.renderText(glm::vec2{5, 30}, canvas.defaultFont(), 11, "graphics: " + std::to_string(graphicsQueue.getSmoothed() * 1000) + "ms");
     canvas.renderText(glm::vec2{5, 45}, canvas.defaultFont(), 11, "frame time: " + std::to_string(frameQueue.getSmoothed() * 1000) + "ms");
+    canvas.renderText(glm::vec2{5, 60}, canvas.defaultFont(), 11, "solver: " + std::to_string(static_cast<std::size_t>(util::getProfileCounter("physics.constraints"))) + " constraints, "
+        + std::to_string(static_cast<std::size_t>(util::getProfileCounter("physics.solver_colours"))) + " colours, largest batch "
+        + std::to_string(static_cast<std::size_t>(util::getProfileCounter("physics.solver_largest_batch"))));
 
     canvas.renderText(glm::vec2{700, 15}, canvas.defaultFont(), 11, std::to_string(1.0f / deltaTimeQueue.getSmoothed()) + " fps", {0.0f, 1.0f, 0.0f});
 }
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "core/entity_id.h"
+#include "core/iresource.h"
+#include "graphics/maths_headers.h"
+
+namespace phenyl::physics {
+    enum class CollisionEventType2D {
+        BEGIN,
+        PERSIST,
+        END
+    };
+
+    struct CollisionEvent2D {
+        CollisionEventType2D type;
+        core::EntityId entity1;
+        core::EntityId entity2;
+        std::uint64_t layers1;
+        std::uint64_t layers2;
+        // Last known contact for END events
+        glm::vec2 contactPoint;
+        // Points from entity1 to entity2
+        glm::vec2 normal;
+        bool isTrigger;
+    };
+
+    // Contact events of the most recent physics step, derived from a cache of the previous step's contacts. Consume in
+    // FixedUpdate, or in PhysicsUpdate after Physics2D::CollisionCheck, as the buffer is cleared every step.
+    class CollisionEvents2D : public core::IResource {
+    private:
+        struct ContactKey {
+            std::size_t entity1;
+            std::size_t entity2;
+
+            bool operator== (const ContactKey& other) const noexcept = default;
+        };
+
+        struct ContactKeyHash {
+            std::size_t operator() (const ContactKey& key) const noexcept {
+                return std::hash<std::size_t>{}(key.entity1) ^ (std::hash<std::size_t>{}(key.entity2) << 1);
+            }
+        };
+
+        struct CachedContact {
+            CollisionEvent2D event;
+            std::uint64_t lastStep;
+        };
+
+        std::vector<CollisionEvent2D> eventBuffer;
+        std::unordered_map<ContactKey, CachedContact, ContactKeyHash> contactCache;
+        std::uint64_t step = 0;
+
+        void beginStep ();
+        void onContact (core::EntityId entity1, core::EntityId entity2, std::uint64_t layers1, std::uint64_t layers2, glm::vec2 contactPoint, glm::vec2 normal, bool isTrigger);
+        // Contacts between two paused entities are held without events, as neither was simulated this step
+        void endStep (const std::function<bool(core::EntityId)>& isPaused);
+
+        friend class Physics2D;
+    public:
+        // Whether contacts are tracked and events recorded
+        bool recordEvents = true;
+        // Whether OnCollision is raised on both entities for every contact every step
+        bool raiseSignals = false;
+
+        [[nodiscard]] std::span<const CollisionEvent2D> events () const noexcept {
+            return eventBuffer;
+        }
+
+        [[nodiscard]] std::string_view getName () const noexcept override {
+            return "CollisionEvents2D";
+        }
+    };
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "core/iresource.h"
+
+namespace phenyl::physics {
+    // Global layer interaction rules, applied on top of each collider's layers and mask. Layers are bit indices into
+    // Collider2D::layers.
+    class CollisionLayers2D : public core::IResource {
+    private:
+        // Bit j of row i is set if layer i may interact with layer j
+        std::array<std::uint64_t, 64> layerMatrix;
+        std::uint64_t triggerLayers = 0;
+    public:
+        static constexpr std::size_t MAX_LAYERS = 64;
+
+        CollisionLayers2D ();
+
+        void setLayersInteract (std::size_t layer1, std::size_t layer2, bool interact);
+        [[nodiscard]] bool layersInteract (std::size_t layer1, std::size_t layer2) const;
+
+        // Colliders on trigger layers raise collision signals but are never pushed apart
+        void setTriggerLayer (std::size_t layer, bool trigger = true);
+        [[nodiscard]] bool isTrigger (std::uint64_t layers) const noexcept {
+            return layers & triggerLayers;
+        }
+
+        // Whether colliders with these layers and masks can ever form a pair
+        [[nodiscard]] bool shouldCollide (std::uint64_t layers1, std::uint64_t mask1, std::uint64_t layers2, std::uint64_t mask2) const noexcept;
+
+        [[nodiscard]] std::string_view getName () const noexcept override {
+            return "CollisionLayers2D";
+        }
+    };
+}
@@ -16,31 +16,19 @@ namespace phenyl::physics {
         glm::vec2 momentum{0.0f};
         float angularMomentum{0.0f};
 
-        glm::vec2 appliedImpulse{0.0f, 0.0f};
-        float appliedAngularImpulse{0.0f};
-
         float outerRadius{0.0f};
 
-        [[nodiscard]] glm::vec2 getCurrVelocity () const {
-            return (momentum + appliedImpulse) * invMass;
-        }
-
-        [[nodiscard]] float getCurrAngularVelocity () const {
-            return (angularMomentum + appliedAngularImpulse) * invInertiaMoment;
-        }
-
-        void applyImpulse (glm::vec2 impulse) {
-            appliedImpulse += impulse;
-        }
-
-        void applyAngularImpulse (float angularImpulse) {
-            appliedAngularImpulse += angularImpulse;
-        }
+        // Index into SolverBodies2D, only valid while solverStep matches
+        std::size_t solverIndex{0};
+        std::uint64_t solverStep{0};
 
+        // Set by StaticBody2D, static pairs are skipped by the broadphase
+        bool staticBody{false};
 
         friend class Physics2D;
         friend class Constraint2D;
         friend class Manifold2D;
+        friend class SolverBodies2D;
     protected:
         void setOuterRadius (float newOuterRadius) {
             outerRadius = newOuterRadius;
@@ -61,8 +49,19 @@ namespace phenyl::physics {
         Collider2D () = default;
 
         void syncUpdates (const RigidBody2D& body, glm::vec2 pos);
-        void updateBody (RigidBody2D& body) const;
+        void syncStatic (glm::vec2 pos);
         [[nodiscard]] bool shouldCollide (const Collider2D& other) const;
+        // Bounding circle test only, for pairs whose layers are already known to interact
+        [[nodiscard]] bool boundsOverlap (const Collider2D& other) const;
+
+        // Static colliders are never written to by the constraint solver
+        [[nodiscard]] bool isDynamic () const noexcept {
+            return invMass != 0 || invInertiaMoment != 0;
+        }
+
+        [[nodiscard]] bool isStatic () const noexcept {
+            return staticBody;
+        }
     };
 
     PHENYL_DECLARE_SERIALIZABLE(Collider2D)
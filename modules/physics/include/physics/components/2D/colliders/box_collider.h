@@ -5,7 +5,7 @@
 #include "util/optional.h"
 
 namespace phenyl::physics {
-    class SATResult2D;
+    struct SATResult2D;
     class Face2D;
     class BoxCollider2D : public Collider2D {
     private:
@@ -13,6 +13,7 @@ namespace phenyl::physics {
         glm::mat2 frameTransform;
 
         friend class Physics2D;
+        friend class CircleCollider2D;
         PHENYL_SERIALIZABLE_INTRUSIVE(BoxCollider2D)
     public:
         util::Optional<SATResult2D> collide (const BoxCollider2D& other);
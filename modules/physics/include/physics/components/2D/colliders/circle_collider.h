@@ -0,0 +1,38 @@
+#pragma once
+
+#include "physics/components/2D/collider.h"
+#include "core/serialization/serializer_forward.h"
+#include "util/optional.h"
+
+namespace phenyl::physics {
+    struct SATResult2D;
+    class BoxCollider2D;
+    class CircleCollider2D : public Collider2D {
+    private:
+        float radius{0.0f};
+
+        friend class Physics2D;
+        PHENYL_SERIALIZABLE_INTRUSIVE(CircleCollider2D)
+    public:
+        void syncUpdates (const RigidBody2D& body, glm::vec2 pos);
+        void syncStatic (glm::vec2 pos);
+
+        // Normals point from this collider to the other
+        [[nodiscard]] util::Optional<SATResult2D> collide (const CircleCollider2D& other) const;
+        [[nodiscard]] util::Optional<SATResult2D> collide (const BoxCollider2D& box) const;
+
+        // Midpoint of the overlap along the collision normal
+        [[nodiscard]] glm::vec2 getContactPoint (const SATResult2D& result) const;
+
+        [[nodiscard]] float getRadius () const {
+            return radius;
+        }
+
+        void setRadius (float newRadius) {
+            radius = newRadius;
+            setOuterRadius(newRadius);
+        }
+    };
+
+    PHENYL_DECLARE_SERIALIZABLE(CircleCollider2D)
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include "core/serialization/serializer_forward.h"
+
+namespace phenyl::physics {
+    // Marks a body as fast moving. Its motion each fixed step is swept against other colliders so that it cannot
+    // tunnel through them.
+    struct ContinuousCollision2D {};
+
+    PHENYL_DECLARE_SERIALIZABLE(ContinuousCollision2D)
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "core/serialization/serializer_forward.h"
+#include "graphics/maths_headers.h"
+
+namespace phenyl::core {
+    class Entity;
+}
+
+namespace phenyl::physics {
+    // Marks a collider that never moves. Static bodies have infinite mass, are skipped by the motion, sync and
+    // write-back systems, and are never tested against other static bodies. They should not have a RigidBody2D.
+    //
+    // The collider is only updated when the component is inserted, or when the body is moved with Move() or Sync().
+    struct StaticBody2D {
+        // Sets the position of a static body and updates its collider
+        static void Move (core::Entity entity, glm::vec2 position);
+        // Updates the collider of a static body after its GlobalTransform2D has been changed directly
+        static void Sync (core::Entity entity);
+    };
+
+    PHENYL_DECLARE_SERIALIZABLE(StaticBody2D)
+}
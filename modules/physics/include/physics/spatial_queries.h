@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "core/entity.h"
+#include "core/iresource.h"
+#include "graphics/maths_headers.h"
+#include "util/optional.h"
+
+namespace phenyl::core {
+    class ThreadPool;
+}
+
+namespace phenyl::physics {
+    struct QueryHit2D {
+        core::Entity entity;
+        glm::vec2 point;
+        // Surface normal at point. Zero for overlap and nearest queries from inside a collider.
+        glm::vec2 normal;
+        float distance;
+    };
+
+    struct Ray2D {
+        glm::vec2 origin;
+        glm::vec2 direction;
+        float maxDistance;
+        std::uint64_t mask = ~std::uint64_t{0};
+    };
+
+    // Spatial queries against the colliders as of the last physics step. Colliders are bucketed by layer, so masks
+    // skip whole buckets. Casts ignore colliders that already contain their origin.
+    class SpatialQueries2D : public core::IResource {
+    private:
+        struct QueryCollider {
+            core::Entity entity;
+            glm::vec2 position;
+            float outerRadius;
+            // Box frame transform if isBox, otherwise only the circle radius is used
+            glm::mat2 frameTransform;
+            float radius;
+            bool isBox;
+        };
+
+        struct QueryBucket {
+            std::uint64_t layers;
+            std::vector<QueryCollider> colliders;
+        };
+
+        std::vector<QueryBucket> buckets;
+        core::ThreadPool& threadPool;
+
+        void clear ();
+        void addBox (core::Entity entity, glm::vec2 position, float outerRadius, std::uint64_t layers, const glm::mat2& frameTransform);
+        void addCircle (core::Entity entity, glm::vec2 position, std::uint64_t layers, float radius);
+        QueryBucket& getBucket (std::uint64_t layers);
+
+        friend class Physics2D;
+    public:
+        static constexpr std::uint64_t ALL_LAYERS = ~std::uint64_t{0};
+
+        explicit SpatialQueries2D (core::ThreadPool& threadPool);
+
+        [[nodiscard]] util::Optional<QueryHit2D> raycast (glm::vec2 origin, glm::vec2 direction, float maxDistance, std::uint64_t mask = ALL_LAYERS) const;
+        [[nodiscard]] util::Optional<QueryHit2D> raycast (const Ray2D& ray) const;
+
+        // Sweeps a circle along the ray. Boxes are treated as inflated by the radius.
+        [[nodiscard]] util::Optional<QueryHit2D> circleCast (glm::vec2 origin, float radius, glm::vec2 direction, float maxDistance, std::uint64_t mask = ALL_LAYERS) const;
+
+        // Appends every collider overlapping the axis aligned box
+        void overlapAABB (glm::vec2 min, glm::vec2 max, std::vector<core::Entity>& results, std::uint64_t mask = ALL_LAYERS) const;
+
+        // Up to k colliders closest to point, nearest first, by distance to their surface
+        void nearest (glm::vec2 point, std::size_t k, std::vector<QueryHit2D>& results, std::uint64_t mask = ALL_LAYERS) const;
+
+        // Runs many raycasts at once, spread across the thread pool. results must be the same size as rays.
+        void raycastBatch (std::span<const Ray2D> rays, std::span<util::Optional<QueryHit2D>> results) const;
+
+        [[nodiscard]] std::string_view getName () const noexcept override {
+            return "SpatialQueries2D";
+        }
+    };
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "core/entity.h"
+#include "physics/collision_layers.h"
+
+namespace phenyl::physics {
+    // Buckets colliders by their (layers, mask) pair and whether they are static. Whether two colliders may interact
+    // only depends on these, so it is decided once per bucket pair and non-interacting buckets (including two static
+    // buckets) never produce candidate pairs.
+    template <typename T>
+    class LayerBuckets2D {
+    public:
+        struct Entry {
+            core::Entity entity;
+            T* collider;
+        };
+    private:
+        struct Bucket {
+            std::uint64_t layers;
+            std::uint64_t mask;
+            bool isStatic;
+            std::vector<Entry> entries;
+
+            [[nodiscard]] bool interacts (const CollisionLayers2D& collisionLayers, std::uint64_t otherLayers, std::uint64_t otherMask, bool otherStatic) const {
+                return !(isStatic && otherStatic) && collisionLayers.shouldCollide(layers, mask, otherLayers, otherMask);
+            }
+        };
+
+        // Buckets are kept between steps so their storage is reused
+        std::vector<Bucket> buckets;
+
+        Bucket& getBucket (std::uint64_t layers, std::uint64_t mask, bool isStatic) {
+            // Few distinct layer setups in practice, so a linear search is cheapest
+            for (auto& bucket : buckets) {
+                if (bucket.layers == layers && bucket.mask == mask && bucket.isStatic == isStatic) {
+                    return bucket;
+                }
+            }
+
+            return buckets.emplace_back(Bucket{.layers=layers, .mask=mask, .isStatic=isStatic, .entries={}});
+        }
+
+        template <typename U>
+        friend class LayerBuckets2D;
+    public:
+        void clear () {
+            for (auto& bucket : buckets) {
+                bucket.entries.clear();
+            }
+        }
+
+        void add (core::Entity entity, T& collider) {
+            getBucket(collider.layers, collider.mask, collider.isStatic()).entries.emplace_back(Entry{entity, &collider});
+        }
+
+        template <typename F>
+        void each (F&& fn) const {
+            for (const auto& bucket : buckets) {
+                for (const auto& entry : bucket.entries) {
+                    fn(entry);
+                }
+            }
+        }
+
+        // Calls fn(entry1, entry2, isTrigger) for every unordered pair of colliders whose layers interact
+        template <typename F>
+        void pairs (const CollisionLayers2D& collisionLayers, F&& fn) const {
+            for (std::size_t i = 0; i < buckets.size(); i++) {
+                const auto& bucket1 = buckets[i];
+                if (bucket1.entries.empty()) {
+                    continue;
+                }
+
+                for (std::size_t j = i; j < buckets.size(); j++) {
+                    const auto& bucket2 = buckets[j];
+                    if (bucket2.entries.empty() || !bucket1.interacts(collisionLayers, bucket2.layers, bucket2.mask, bucket2.isStatic)) {
+                        continue;
+                    }
+
+                    bool isTrigger = collisionLayers.isTrigger(bucket1.layers) || collisionLayers.isTrigger(bucket2.layers);
+                    if (i == j) {
+                        for (std::size_t a = 0; a < bucket1.entries.size(); a++) {
+                            for (std::size_t b = a + 1; b < bucket1.entries.size(); b++) {
+                                fn(bucket1.entries[a], bucket1.entries[b], isTrigger);
+                            }
+                        }
+                    } else {
+                        for (const auto& entry1 : bucket1.entries) {
+                            for (const auto& entry2 : bucket2.entries) {
+                                fn(entry1, entry2, isTrigger);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        // Calls fn(entry, otherEntry, isTrigger) for every pair between this and other whose layers interact
+        template <typename U, typename F>
+        void crossPairs (const LayerBuckets2D<U>& other, const CollisionLayers2D& collisionLayers, F&& fn) const {
+            for (const auto& bucket1 : buckets) {
+                if (bucket1.entries.empty()) {
+                    continue;
+                }
+
+                for (const auto& bucket2 : other.buckets) {
+                    if (bucket2.entries.empty() || !bucket1.interacts(collisionLayers, bucket2.layers, bucket2.mask, bucket2.isStatic)) {
+                        continue;
+                    }
+
+                    bool isTrigger = collisionLayers.isTrigger(bucket1.layers) || collisionLayers.isTrigger(bucket2.layers);
+                    for (const auto& entry1 : bucket1.entries) {
+                        for (const auto& entry2 : bucket2.entries) {
+                            fn(entry1, entry2, isTrigger);
+                        }
+                    }
+                }
+            }
+        }
+    };
+}
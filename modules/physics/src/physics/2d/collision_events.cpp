@@ -0,0 +1,57 @@
+#include "physics/collision_events.h"
+
+using namespace phenyl::physics;
+
+void CollisionEvents2D::beginStep () {
+    eventBuffer.clear();
+    step++;
+}
+
+void CollisionEvents2D::onContact (core::EntityId entity1, core::EntityId entity2, std::uint64_t layers1, std::uint64_t layers2, glm::vec2 contactPoint, glm::vec2 normal, bool isTrigger) {
+    if (!recordEvents) {
+        return;
+    }
+
+    // Pairs are cached independent of order
+    ContactKey key = entity1.value() < entity2.value() ? ContactKey{entity1.value(), entity2.value()} : ContactKey{entity2.value(), entity1.value()};
+    CollisionEvent2D event{
+        .type=CollisionEventType2D::BEGIN,
+        .entity1=entity1,
+        .entity2=entity2,
+        .layers1=layers1,
+        .layers2=layers2,
+        .contactPoint=contactPoint,
+        .normal=normal,
+        .isTrigger=isTrigger
+    };
+
+    auto [it, inserted] = contactCache.try_emplace(key, CachedContact{.event=event, .lastStep=step});
+    if (!inserted) {
+        if (it->second.lastStep == step) {
+            // Pair already touching through another shape
+            return;
+        }
+
+        event.type = CollisionEventType2D::PERSIST;
+        it->second = CachedContact{.event=event, .lastStep=step};
+    }
+
+    eventBuffer.emplace_back(event);
+}
+
+void CollisionEvents2D::endStep (const std::function<bool(core::EntityId)>& isPaused) {
+    for (auto it = contactCache.begin(); it != contactCache.end(); ) {
+        if (it->second.lastStep != step && isPaused(it->second.event.entity1) && isPaused(it->second.event.entity2)) {
+            it->second.lastStep = step;
+            ++it;
+        } else if (it->second.lastStep != step) {
+            auto event = it->second.event;
+            event.type = CollisionEventType2D::END;
+            eventBuffer.emplace_back(event);
+
+            it = contactCache.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
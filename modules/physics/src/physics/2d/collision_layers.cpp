@@ -0,0 +1,52 @@
+#include <bit>
+
+#include "logging/logging.h"
+#include "physics/collision_layers.h"
+
+using namespace phenyl::physics;
+
+CollisionLayers2D::CollisionLayers2D () {
+    layerMatrix.fill(~std::uint64_t{0});
+}
+
+void CollisionLayers2D::setLayersInteract (std::size_t layer1, std::size_t layer2, bool interact) {
+    PHENYL_ASSERT_MSG(layer1 < MAX_LAYERS && layer2 < MAX_LAYERS, "Invalid collision layers ({}, {})", layer1, layer2);
+
+    if (interact) {
+        layerMatrix[layer1] |= std::uint64_t{1} << layer2;
+        layerMatrix[layer2] |= std::uint64_t{1} << layer1;
+    } else {
+        layerMatrix[layer1] &= ~(std::uint64_t{1} << layer2);
+        layerMatrix[layer2] &= ~(std::uint64_t{1} << layer1);
+    }
+}
+
+bool CollisionLayers2D::layersInteract (std::size_t layer1, std::size_t layer2) const {
+    PHENYL_ASSERT_MSG(layer1 < MAX_LAYERS && layer2 < MAX_LAYERS, "Invalid collision layers ({}, {})", layer1, layer2);
+
+    return layerMatrix[layer1] & (std::uint64_t{1} << layer2);
+}
+
+void CollisionLayers2D::setTriggerLayer (std::size_t layer, bool trigger) {
+    PHENYL_ASSERT_MSG(layer < MAX_LAYERS, "Invalid collision layer {}", layer);
+
+    if (trigger) {
+        triggerLayers |= std::uint64_t{1} << layer;
+    } else {
+        triggerLayers &= ~(std::uint64_t{1} << layer);
+    }
+}
+
+bool CollisionLayers2D::shouldCollide (std::uint64_t layers1, std::uint64_t mask1, std::uint64_t layers2, std::uint64_t mask2) const noexcept {
+    if (!(layers1 & mask2 || layers2 & mask1)) {
+        return false;
+    }
+
+    for (auto remaining = layers1; remaining; remaining &= remaining - 1) {
+        if (layerMatrix[std::countr_zero(remaining)] & layers2) {
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -47,7 +47,7 @@ Manifold2D phenyl::physics::buildManifold (const physics::Face2D& face1, const p
     }
 }
 
-Constraint2D Manifold2D::buildConstraint (Collider2D* obj1, Collider2D* obj2, float deltaTime) const {
+Constraint2D Manifold2D::buildConstraint (Collider2D* obj1, Collider2D* obj2, SolverBodies2D& bodies, float deltaTime) const {
     auto contactPoint = (points[0] + points[1]) / 2.0f;
     auto r1 = contactPoint - obj1->getPosition();
     auto r2 = contactPoint - obj2->getPosition();
@@ -56,37 +56,37 @@ Constraint2D Manifold2D::buildConstraint (Collider2D* obj1, Collider2D* obj2, fl
     auto elasticityTerm = glm::dot(normal, obj1->momentum * obj1->invMass + r1 * obj1->angularMomentum * obj1->invInertiaMoment - obj2->momentum * obj2->invMass - r2 * obj2->angularMomentum * obj2->invInertiaMoment);
 
     float bias = -BAUMGARTE_TERM / deltaTime * (glm::max(depth + BAUMGARTE_SLOP, 0.0f)) - elasticity * elasticityTerm;
-    return Constraint2D::ContactConstraint(obj1, obj2, contactPoint, normal, bias);
+    return Constraint2D::ContactConstraint(*obj1, bodies.add(*obj1), *obj2, bodies.add(*obj2), contactPoint, normal, bias);
 }
 
 glm::vec2 Manifold2D::getContactPoint () const {
     return (points[0] + points[1]) / 2.0f;
 }
 
-Constraint2D Constraint2D::ContactConstraint (Collider2D* obj1, Collider2D* obj2, glm::vec2 contactPoint, glm::vec2 normal, float bias) {
+Constraint2D Constraint2D::ContactConstraint (const Collider2D& obj1, std::size_t body1, const Collider2D& obj2, std::size_t body2, glm::vec2 contactPoint, glm::vec2 normal, float bias) {
     // See https://kevinyu.net/2018/01/17/understanding-constraint-solver-in-physics-engine/ and
     // https://research.ncl.ac.uk/game/mastersdegree/gametechnologies/previousinformation/physics6collisionresponse/2017%20Tutorial%206%20-%20Collision%20Response.pdf
 
-    auto r1 = contactPoint - obj1->currentPos;
-    auto r2 = contactPoint - obj2->currentPos;
+    auto r1 = contactPoint - obj1.currentPos;
+    auto r2 = contactPoint - obj2.currentPos;
 
-    auto jVelObj1 = obj1->invMass != 0 ? -normal : glm::vec2{0, 0};
-    auto jWObj1 = obj1->invInertiaMoment != 0 ? vec2dCross(-r1, normal) : 0.0f;
+    auto jVelObj1 = obj1.invMass != 0 ? -normal : glm::vec2{0, 0};
+    auto jWObj1 = obj1.invInertiaMoment != 0 ? vec2dCross(-r1, normal) : 0.0f;
 
-    auto jVelObj2 = obj2->invMass != 0 ? normal : glm::vec2{0, 0};
-    auto jWObj2 = obj2->invInertiaMoment != 0 ? vec2dCross(r2, normal) : 0.0f;
+    auto jVelObj2 = obj2.invMass != 0 ? normal : glm::vec2{0, 0};
+    auto jWObj2 = obj2.invInertiaMoment != 0 ? vec2dCross(r2, normal) : 0.0f;
 
     float jacobMass = 0.0f;
-    jacobMass += glm::dot(jVelObj1 * glm::vec2{1 * obj1->invMass, 1 * obj1->invMass}, jVelObj1);
-    jacobMass += glm::dot(jVelObj2 * glm::vec2{1 * obj2->invMass, 1 * obj2->invMass}, jVelObj2);
-    jacobMass += jWObj1 * obj1->invInertiaMoment * jWObj1;
-    jacobMass += jWObj2 * obj2->invInertiaMoment * jWObj2;
+    jacobMass += glm::dot(jVelObj1 * glm::vec2{1 * obj1.invMass, 1 * obj1.invMass}, jVelObj1);
+    jacobMass += glm::dot(jVelObj2 * glm::vec2{1 * obj2.invMass, 1 * obj2.invMass}, jVelObj2);
+    jacobMass += jWObj1 * obj1.invInertiaMoment * jWObj1;
+    jacobMass += jWObj2 * obj2.invInertiaMoment * jWObj2;
 
     auto invJacobMass = 1 / jacobMass;
 
     return Constraint2D {
-            .obj1=obj1,
-            .obj2=obj2,
+            .body1=body1,
+            .body2=body2,
             .jVelObj1=jVelObj1,
             .jVelObj2=jVelObj2,
             .jWObj1=jWObj1,
@@ -99,8 +99,8 @@ Constraint2D Constraint2D::ContactConstraint (Collider2D* obj1, Collider2D* obj2
 
 
 
-bool Constraint2D::solve () {
-    float lambda = -(glm::dot(jVelObj1, obj1->getCurrVelocity()) + glm::dot(jVelObj2, obj2->getCurrVelocity()) + jWObj1 * obj1->getCurrAngularVelocity() + jWObj2 * obj2->getCurrAngularVelocity() + bias) * invJacobMass;
+bool Constraint2D::solve (SolverBodies2D& bodies) {
+    float lambda = -(glm::dot(jVelObj1, bodies.velocity(body1)) + glm::dot(jVelObj2, bodies.velocity(body2)) + jWObj1 * bodies.angularVelocity(body1) + jWObj2 * bodies.angularVelocity(body2) + bias) * invJacobMass;
     float newLambda = glm::clamp(lambdaSum + lambda, lambdaClamp[0], lambdaClamp[1]);
 
     float lambdaDiff = newLambda - lambdaSum;
@@ -108,11 +108,8 @@ bool Constraint2D::solve () {
     if (glm::abs(lambdaDiff) < std::numeric_limits<float>::epsilon()) {
         return false;
     } else {
-        obj1->applyImpulse(jVelObj1 * lambdaDiff);
-        obj2->applyImpulse(jVelObj2 * lambdaDiff);
-
-        obj1->applyAngularImpulse(jWObj1 * lambdaDiff);
-        obj2->applyAngularImpulse(jWObj2 * lambdaDiff);
+        bodies.applyImpulse(body1, jVelObj1 * lambdaDiff, jWObj1 * lambdaDiff);
+        bodies.applyImpulse(body2, jVelObj2 * lambdaDiff, jWObj2 * lambdaDiff);
 
         return true;
     }
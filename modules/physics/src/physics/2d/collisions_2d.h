@@ -2,6 +2,7 @@
 
 #include "graphics/maths_headers.h"
 #include "physics/components/2D/collider.h"
+#include "solver_bodies_2d.h"
 
 namespace phenyl::physics {
     struct SATResult2D {
@@ -23,8 +24,8 @@ namespace phenyl::physics {
     };
 
     struct Constraint2D {
-        Collider2D* obj1;
-        Collider2D* obj2;
+        std::size_t body1;
+        std::size_t body2;
         glm::vec2 jVelObj1;
         glm::vec2 jVelObj2;
         float jWObj1;
@@ -37,9 +38,9 @@ namespace phenyl::physics {
 
         std::array<float, 2> lambdaClamp;
 
-        static Constraint2D ContactConstraint (Collider2D* obj1, Collider2D* obj2, glm::vec2 contactPoint, glm::vec2 normal, float bias);
+        static Constraint2D ContactConstraint (const Collider2D& obj1, std::size_t body1, const Collider2D& obj2, std::size_t body2, glm::vec2 contactPoint, glm::vec2 normal, float bias);
 
-        bool solve ();
+        bool solve (SolverBodies2D& bodies);
     };
 
     enum class Manifold2DType : char {
@@ -53,7 +54,7 @@ namespace phenyl::physics {
         float depth;
         Manifold2DType type;
 
-        Constraint2D buildConstraint (Collider2D* obj1, Collider2D* obj2, float deltaTime) const;
+        Constraint2D buildConstraint (Collider2D* obj1, Collider2D* obj2, SolverBodies2D& bodies, float deltaTime) const;
 
         glm::vec2 getContactPoint () const;
     };
@@ -0,0 +1,68 @@
+#include <algorithm>
+#include <bit>
+
+#include "constraint_batches_2d.h"
+
+using namespace phenyl::physics;
+
+void ConstraintBatches2D::build (std::vector<Constraint2D>& constraints, std::size_t numBodies) {
+    bodyColours.assign(numBodies, 0);
+    constraintColours.clear();
+    constraintColours.reserve(constraints.size());
+
+    // One bucket per colour plus the serial bucket
+    std::vector<std::size_t> counts(MAX_COLOURS + 1);
+    for (const auto& c : constraints) {
+        // The static body is never written to so never conflicts, leaving its colours at 0
+        std::size_t colour = std::countr_one(bodyColours[c.body1] | bodyColours[c.body2]);
+        if (colour < MAX_COLOURS) {
+            auto colourBit = std::uint64_t{1} << colour;
+            if (c.body1 != SolverBodies2D::STATIC_BODY) {
+                bodyColours[c.body1] |= colourBit;
+            }
+            if (c.body2 != SolverBodies2D::STATIC_BODY) {
+                bodyColours[c.body2] |= colourBit;
+            }
+        }
+
+        constraintColours.emplace_back(colour);
+        counts[colour]++;
+    }
+
+    batchOffsets.assign(MAX_COLOURS + 2, 0);
+    for (std::size_t i = 0; i < counts.size(); i++) {
+        batchOffsets[i + 1] = batchOffsets[i] + counts[i];
+    }
+
+    // Stable scatter into colour order
+    auto insertPos = batchOffsets;
+    sortedConstraints.resize(constraints.size());
+    for (std::size_t i = 0; i < constraints.size(); i++) {
+        sortedConstraints[insertPos[constraintColours[i]]++] = constraints[i];
+    }
+    constraints.swap(sortedConstraints);
+}
+
+std::size_t ConstraintBatches2D::numColours () const noexcept {
+    std::size_t colours = 0;
+    for (std::size_t i = 0; i < numBatches() && isParallel(i); i++) {
+        if (batchOffsets[i + 1] != batchOffsets[i]) {
+            colours++;
+        }
+    }
+
+    return colours;
+}
+
+std::size_t ConstraintBatches2D::largestBatch () const noexcept {
+    std::size_t largest = 0;
+    for (std::size_t i = 0; i < numBatches(); i++) {
+        largest = std::max(largest, batchOffsets[i + 1] - batchOffsets[i]);
+    }
+
+    return largest;
+}
+
+std::size_t ConstraintBatches2D::serialBatchSize () const noexcept {
+    return numBatches() > MAX_COLOURS ? batchOffsets[MAX_COLOURS + 1] - batchOffsets[MAX_COLOURS] : 0;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "collisions_2d.h"
+
+namespace phenyl::physics {
+    // Greedy graph colouring of constraints. Constraints within a colour share no dynamic solver bodies, so each colour
+    // batch can be solved in parallel. Constraints that do not fit in MAX_COLOURS colours go into a final serial batch.
+    class ConstraintBatches2D {
+    private:
+        std::vector<std::size_t> batchOffsets;
+        std::vector<std::size_t> constraintColours;
+        std::vector<Constraint2D> sortedConstraints;
+        std::vector<std::uint64_t> bodyColours;
+
+    public:
+        static constexpr std::size_t MAX_COLOURS = 64;
+
+        // Reorders constraints by colour. numBodies is the number of solver bodies the constraints index into.
+        void build (std::vector<Constraint2D>& constraints, std::size_t numBodies);
+
+        [[nodiscard]] std::size_t numBatches () const noexcept {
+            return batchOffsets.empty() ? 0 : batchOffsets.size() - 1;
+        }
+
+        [[nodiscard]] std::span<Constraint2D> batch (std::vector<Constraint2D>& constraints, std::size_t index) const {
+            return std::span{constraints}.subspan(batchOffsets[index], batchOffsets[index + 1] - batchOffsets[index]);
+        }
+
+        [[nodiscard]] bool isParallel (std::size_t index) const noexcept {
+            return index < MAX_COLOURS;
+        }
+
+        [[nodiscard]] std::size_t numColours () const noexcept;
+        [[nodiscard]] std::size_t largestBatch () const noexcept;
+        [[nodiscard]] std::size_t serialBatchSize () const noexcept;
+    };
+}
@@ -3,22 +3,42 @@
 #include "core/debug.h"
 
 #include "core/components/2d/global_transform.h"
+#include "core/components/frozen.h"
 #include "physics/components/2D/rigid_body.h"
 #include "physics/components/2D/colliders/box_collider.h"
+#include "physics/components/2D/colliders/circle_collider.h"
+#include "physics/components/2D/static_body.h"
 #include "physics/signals/collision.h"
 
 #include "physics/components/2D/rigid_body.h"
 #include "core/serialization/component_serializer.h"
 #include "core/delta_time.h"
 #include "physics/2d/collisions_2d.h"
+#include "physics/2d/constraint_batches_2d.h"
+#include "physics/2d/sweep_2d.h"
+#include "physics/collision_events.h"
+#include "physics/spatial_queries.h"
 #include "core/runtime.h"
+#include "core/runtime/thread_pool.h"
+#include "util/profiler.h"
+
+#include <random>
 
 #define SOLVER_ITERATIONS 10
+#define SOLVER_MIN_CHUNK 32
+#define CIRCLE_DEBUG_SEGMENTS 16
+// Fraction of the sweep radius a fast body is moved into the collider it hits, so that a contact is generated for it
+#define CCD_PENETRATION 0.05f
+// Random box pairs the batched SAT kernel is checked against the reference implementation on at startup
+#define SAT_CHECK_PAIRS 512
+#define SAT_CHECK_SEED 0x5A7
 
 using namespace phenyl::physics;
 
 struct Constraints2D : public phenyl::core::IResource {
     std::vector<Constraint2D> constraints;
+    SolverBodies2D bodies;
+    ConstraintBatches2D batches;
 
     std::string_view getName() const noexcept override {
         return "Constraints2D";
@@ -35,72 +55,121 @@ static void Collider2DSyncSystem (const phenyl::core::GlobalTransform2D& transfo
     collider.syncUpdates(body, transform.transform2D.position());
 }
 
-static void BoxCollider2DFrameTransformSystem (const phenyl::core::GlobalTransform2D& transform, BoxCollider2D& collider) {
-    collider.applyFrameTransform(transform.transform2D.rotMatrix());
+static void CircleCollider2DSyncSystem (const phenyl::core::GlobalTransform2D& transform, const RigidBody2D& body, CircleCollider2D& collider) {
+    collider.syncUpdates(body, transform.transform2D.position());
 }
 
-static void CollisionCheck2DSystem (const phenyl::core::Resources<Constraints2D, const phenyl::core::FixedDelta>& resources,
-    const phenyl::core::Bundle<BoxCollider2D>& bundle1, const phenyl::core::Bundle<BoxCollider2D>& bundle2) {
-    auto& [constraints, deltaTime] = resources;
+// Static bodies have no RigidBody2D, their frame transform is only updated by StaticBody2D::Sync()
+static void BoxCollider2DFrameTransformSystem (const phenyl::core::GlobalTransform2D& transform, const RigidBody2D& body, BoxCollider2D& collider) {
+    collider.applyFrameTransform(transform.transform2D.rotMatrix());
+}
 
-    auto entity1 = bundle1.entity();
-    auto entity2 = bundle2.entity();
-    auto& box1 = bundle1.get<BoxCollider2D>();
-    auto& box2 = bundle2.get<BoxCollider2D>();
-    if (!box1.shouldCollide(box2)) {
+// Frozen bodies are not simulated, so their colliders act as static ones until Collider2D::Sync runs after they wake,
+// or for reduced bodies, during their reduced steps.
+// They still block active bodies, while pairs of frozen or static colliders are skipped by the broadphase.
+static void FreezeBody2D (phenyl::core::Entity entity) {
+    const auto* transform = entity.get<phenyl::core::GlobalTransform2D>();
+    if (!transform || !entity.has<RigidBody2D>() || !entity.has<phenyl::core::Frozen>()) {
         return;
     }
 
-    box1.collide(box2)
-        .ifPresent([&] (SATResult2D result) {
-            auto face1 = box1.getSignificantFace(result.normal);
-            auto face2 = box2.getSignificantFace(-result.normal);
+    if (auto* box = entity.get<BoxCollider2D>()) {
+        box->syncStatic(transform->transform2D.position());
+        box->applyFrameTransform(transform->transform2D.rotMatrix());
+    }
 
-            auto manifold = buildManifold(face1, face2, result.normal, result.depth);
-            constraints.constraints.emplace_back(manifold.buildConstraint(&box1, &box2, deltaTime()));
+    if (auto* circle = entity.get<CircleCollider2D>()) {
+        circle->syncStatic(transform->transform2D.position());
+    }
+}
 
-            auto contactPoint = manifold.getContactPoint();
-            if (box1.layers & box2.mask) {
-                //manager._signal<OnCollision>(entity2.id(), entity1.id(), (std::uint32_t)(box1.layers & box2.mask));
-                entity2.raise(OnCollision{entity1.id(), (std::uint32_t)(box1.layers & box2.mask), contactPoint, -result.normal});
-                //events.emplace_back(info2.id(), info1.id(), box1.layers & box2.mask);
-            }
+static glm::vec2 ResolveManifold (Constraints2D& constraints, float deltaTime, Collider2D& coll1, Collider2D& coll2, const Manifold2D& manifold) {
+    constraints.constraints.emplace_back(manifold.buildConstraint(&coll1, &coll2, constraints.bodies, deltaTime));
 
-            if (box2.layers & box1.mask) {
-                //manager.signal<OnCollision>(entity1.id(), entity2.id(), (std::uint32_t)(box2.layers & box1.mask));
-                entity1.raise(OnCollision{entity2.id(), (std::uint32_t)(box2.layers & box1.mask), contactPoint, result.normal});
-                //events.emplace_back(info1.id(), info2.id(), box2.layers & box1.mask);
-            }
-        });
+    return manifold.getContactPoint();
 }
 
-static void Constraints2DSolveSystem (const phenyl::core::Resources<Constraints2D>& resources) {
-    auto& [constraints] = resources;
+static glm::vec2 ResolveBoxCollision (Constraints2D& constraints, float deltaTime, BoxCollider2D& box1, BoxCollider2D& box2, SATResult2D result) {
+    auto face1 = box1.getSignificantFace(result.normal);
+    auto face2 = box2.getSignificantFace(-result.normal);
+
+    return ResolveManifold(constraints, deltaTime, box1, box2, buildManifold(face1, face2, result.normal, result.depth));
+}
+
+static glm::vec2 ResolveCircleCollision (Constraints2D& constraints, float deltaTime, CircleCollider2D& circle, Collider2D& other, SATResult2D result) {
+    // Circles only ever touch at a single point
+    auto contactPoint = circle.getContactPoint(result);
+    return ResolveManifold(constraints, deltaTime, circle, other, Manifold2D{.points={contactPoint, contactPoint}, .normal=result.normal, .depth=result.depth, .type=Manifold2DType::POINT});
+}
+
+static void Constraints2DSolveSystem (const phenyl::core::Resources<Constraints2D, phenyl::core::ThreadPool>& resources) {
+    auto& [constraints, threadPool] = resources;
 
+    constraints.batches.build(constraints.constraints, constraints.bodies.size());
+    phenyl::util::setProfileCounter("physics.constraints", static_cast<double>(constraints.constraints.size()));
+    phenyl::util::setProfileCounter("physics.solver_colours", static_cast<double>(constraints.batches.numColours()));
+    phenyl::util::setProfileCounter("physics.solver_largest_batch", static_cast<double>(constraints.batches.largestBatch()));
+    phenyl::util::setProfileCounter("physics.solver_serial_batch", static_cast<double>(constraints.batches.serialBatchSize()));
+
+    auto iterations = 0;
     for (auto i = 0; i < SOLVER_ITERATIONS; i++) {
-        bool shouldContinue = false;
+        iterations++;
+        std::atomic<bool> shouldContinue = false;
+
+        for (std::size_t b = 0; b < constraints.batches.numBatches(); b++) {
+            auto batch = constraints.batches.batch(constraints.constraints, b);
+            if (batch.empty()) {
+                continue;
+            }
+
+            auto solveRange = [&] (std::size_t start, std::size_t end) {
+                bool res = false;
+                for (auto j = start; j < end; j++) {
+                    res = batch[j].solve(constraints.bodies) || res;
+                }
+
+                if (res) {
+                    shouldContinue.store(true, std::memory_order_relaxed);
+                }
+            };
 
-        for (auto& c : constraints.constraints) {
-            auto res = c.solve();
-            shouldContinue = shouldContinue || res;
+            if (constraints.batches.isParallel(b)) {
+                threadPool.parallelFor(batch.size(), SOLVER_MIN_CHUNK, solveRange);
+            } else {
+                solveRange(0, batch.size());
+            }
         }
 
-        if (!shouldContinue) {
+        if (!shouldContinue.load(std::memory_order_relaxed)) {
             break;
         }
     }
 
+    phenyl::util::setProfileCounter("physics.solver_iterations", static_cast<double>(iterations));
     constraints.constraints.clear();
 }
 
-static void Collider2DUpdateSystem (RigidBody2D& body, const BoxCollider2D& collider) {
-    collider.updateBody(body);
+static void Collider2DUpdateSystem (const phenyl::core::Resources<const Constraints2D>& resources, RigidBody2D& body, const BoxCollider2D& collider) {
+    auto& [constraints] = resources;
+
+    constraints.bodies.writeBack(collider, body);
+}
+
+static void CircleCollider2DUpdateSystem (const phenyl::core::Resources<const Constraints2D>& resources, RigidBody2D& body, const CircleCollider2D& collider) {
+    auto& [constraints] = resources;
+
+    constraints.bodies.writeBack(collider, body);
 }
 
 void Physics2D::addComponents (core::PhenylRuntime& runtime) {
+    CheckSATBatch();
+
     runtime.addComponent<RigidBody2D>("RigidBody2D");
     //runtime.addUnserializedComponent<Collider2D>("Collider2D");
     runtime.addComponent<BoxCollider2D>("BoxCollider2D");
+    runtime.addComponent<CircleCollider2D>("CircleCollider2D");
+    runtime.addComponent<ContinuousCollision2D>("ContinuousCollision2D");
+    runtime.addComponent<StaticBody2D>("StaticBody2D");
 
     //runtime.manager().inherits<BoxCollider2D, Collider2D>();
 
@@ -108,19 +177,353 @@ void Physics2D::addComponents (core::PhenylRuntime& runtime) {
     //runtime.manager().addRequirement<BoxCollider2D, common::GlobalTransform2D>();
     //runtime.manager().addRequirement<BoxCollider2D, RigidBody2D>();
 
+    // Static bodies are synced once when complete instead of every step
+    runtime.world().addHandler<StaticBody2D>([] (const core::OnInsert<StaticBody2D>& signal, core::Entity entity) {
+        StaticBody2D::Sync(entity);
+    });
+    runtime.world().addHandler<BoxCollider2D>([] (const core::OnInsert<BoxCollider2D>& signal, core::Entity entity) {
+        StaticBody2D::Sync(entity);
+        FreezeBody2D(entity);
+    });
+    runtime.world().addHandler<CircleCollider2D>([] (const core::OnInsert<CircleCollider2D>& signal, core::Entity entity) {
+        StaticBody2D::Sync(entity);
+        FreezeBody2D(entity);
+    });
+    runtime.world().addHandler<core::GlobalTransform2D>([] (const core::OnInsert<core::GlobalTransform2D>& signal, core::Entity entity) {
+        StaticBody2D::Sync(entity);
+        FreezeBody2D(entity);
+    });
+    runtime.world().addHandler<RigidBody2D>([] (const core::OnInsert<RigidBody2D>& signal, core::Entity entity) {
+        FreezeBody2D(entity);
+    });
+    runtime.world().addHandler<core::Frozen>([] (const core::OnInsert<core::Frozen>& signal, core::Entity entity) {
+        FreezeBody2D(entity);
+    });
+    runtime.world().addHandler<StaticBody2D>([] (const core::OnRemove<StaticBody2D>& signal, core::Entity entity) {
+        if (auto* box = entity.get<BoxCollider2D>()) {
+            box->staticBody = false;
+        }
+        if (auto* circle = entity.get<CircleCollider2D>()) {
+            circle->staticBody = false;
+        }
+    });
+
     runtime.addResource<Constraints2D>();
+    runtime.addResource<CollisionLayers2D>();
+    runtime.addResource<CollisionEvents2D>();
+    runtime.addResource<SpatialQueries2D>(runtime.resource<core::ThreadPool>());
     auto& motionSystem = runtime.addSystem<core::PhysicsUpdate>("RigidBody2D::Update", RigidBody2DMotionSystem);
     auto& syncSystem = runtime.addSystem<core::PhysicsUpdate>("Collider2D::Sync", Collider2DSyncSystem);
+    auto& circleSyncSystem = runtime.addSystem<core::PhysicsUpdate>("CircleCollider2D::Sync", CircleCollider2DSyncSystem);
     auto& boxTransformSystem = runtime.addSystem<core::PhysicsUpdate>("BoxCollider2D::FrameTransform", BoxCollider2DFrameTransformSystem);
-    auto& collCheckSystem = runtime.addSystem<core::PhysicsUpdate>("Physics2D::CollisionCheck", CollisionCheck2DSystem);
-    auto& constraintSolveSystem = runtime.addSystem<core::PhysicsUpdate>("Physics2D::ConstraintsSolve", Constraints2DSolveSystem);
+    // Frozen colliders are still collided with, only the simulation of frozen bodies is skipped
+    boxQuery = runtime.world().query<BoxCollider2D>();
+    circleQuery = runtime.world().query<CircleCollider2D>();
+    fastBoxQuery = runtime.world().activeQuery<core::GlobalTransform2D, RigidBody2D, BoxCollider2D, ContinuousCollision2D>();
+    fastCircleQuery = runtime.world().activeQuery<core::GlobalTransform2D, RigidBody2D, CircleCollider2D, ContinuousCollision2D>();
+    // Reduced bodies are collided and solved in reduced steps too, against everything else acting as static
+    auto& ccdSystem = runtime.addSystem<core::PhysicsUpdate>("Physics2D::ContinuousCollision", this, &Physics2D::continuousCollision).runInReducedSteps();
+    auto& collCheckSystem = runtime.addSystem<core::PhysicsUpdate>("Physics2D::CollisionCheck", this, &Physics2D::collisionCheck).runInReducedSteps();
+    auto& constraintSolveSystem = runtime.addSystem<core::PhysicsUpdate>("Physics2D::ConstraintsSolve", Constraints2DSolveSystem).runInReducedSteps();
     auto& collUpdateSystem = runtime.addSystem<core::PhysicsUpdate>("Collider2D::PostCollision", Collider2DUpdateSystem);
+    auto& circleUpdateSystem = runtime.addSystem<core::PhysicsUpdate>("CircleCollider2D::PostCollision", CircleCollider2DUpdateSystem);
 
     motionSystem.runBefore(syncSystem);
     syncSystem.runBefore(boxTransformSystem);
-    boxTransformSystem.runBefore(collCheckSystem);
+    motionSystem.runBefore(circleSyncSystem);
+    circleSyncSystem.runBefore(ccdSystem);
+    boxTransformSystem.runBefore(ccdSystem);
+    ccdSystem.runBefore(collCheckSystem);
     collCheckSystem.runBefore(constraintSolveSystem);
     constraintSolveSystem.runBefore(collUpdateSystem);
+    constraintSolveSystem.runBefore(circleUpdateSystem);
+}
+
+// The per pair check in collisionCheck() only runs in debug builds, so the SIMD kernel is also checked here, in every build,
+// against BoxCollider2D::collide() on boxes at random orientations, scales and displacements
+void Physics2D::CheckSATBatch () {
+    std::mt19937 rng{SAT_CHECK_SEED};
+    std::uniform_real_distribution<float> angleDist{0.0f, 2.0f * glm::pi<float>()};
+    std::uniform_real_distribution<float> scaleDist{0.1f, 2.0f};
+    std::uniform_real_distribution<float> posDist{-3.0f, 3.0f};
+
+    auto makeBox = [&] (glm::vec2 pos) {
+        auto angle = angleDist(rng);
+        BoxCollider2D box;
+        box.currentPos = pos;
+        box.setScale({scaleDist(rng), scaleDist(rng)});
+        box.applyFrameTransform(glm::mat2{{glm::cos(angle), glm::sin(angle)}, {-glm::sin(angle), glm::cos(angle)}});
+        return box;
+    };
+
+    std::vector<std::pair<BoxCollider2D, BoxCollider2D>> pairs;
+    pairs.reserve(SAT_CHECK_PAIRS);
+    SATBatch2D batch;
+    for (std::size_t i = 0; i < SAT_CHECK_PAIRS; i++) {
+        auto box1 = makeBox({0.0f, 0.0f});
+        auto box2 = makeBox({posDist(rng), posDist(rng)});
+        batch.push(box1.getDisplacement(box2), box1.frameTransform, box2.frameTransform);
+        pairs.emplace_back(std::move(box1), std::move(box2));
+    }
+    batch.run();
+
+    for (std::size_t i = 0; i < pairs.size(); i++) {
+        auto& [box1, box2] = pairs[i];
+        auto reference = box1.collide(box2);
+        PHENYL_ASSERT_MSG(static_cast<bool>(reference) == batch.collided(i), "SAT batch mismatch on check pair {}: expected collided = {}", i, static_cast<bool>(reference));
+        reference.ifPresent([&] (SATResult2D result) {
+            PHENYL_ASSERT_MSG(glm::abs(result.depth - batch.depth(i)) < 1e-4f && glm::length(result.normal - batch.normal(i)) < 1e-3f,
+                "SAT batch mismatch on check pair {}: expected ({}, {}), got ({}, {})", i, result.normal, result.depth, batch.normal(i), batch.depth(i));
+        });
+    }
+}
+
+void Physics2D::continuousCollision (core::PhenylRuntime& runtime) {
+    const auto& collisionLayers = runtime.resource<CollisionLayers2D>();
+    auto deltaTime = static_cast<float>(runtime.resource<core::FixedDelta>()());
+
+    runtime.world().defer();
+
+    std::size_t hits = 0;
+    fastBoxQuery.each([&] (const core::Bundle<core::GlobalTransform2D, RigidBody2D, BoxCollider2D, ContinuousCollision2D>& bundle) {
+        auto& box = bundle.get<BoxCollider2D>();
+        // Inscribed radius, so the sweep never skips past something the box would have hit
+        auto sweepRadius = glm::min(glm::length(box.frameTransform * glm::vec2{1, 0}), glm::length(box.frameTransform * glm::vec2{0, 1}));
+
+        hits += sweepBody(collisionLayers, bundle.entity(), bundle.get<core::GlobalTransform2D>(), bundle.get<RigidBody2D>(), box, sweepRadius, deltaTime) ? 1 : 0;
+    });
+
+    fastCircleQuery.each([&] (const core::Bundle<core::GlobalTransform2D, RigidBody2D, CircleCollider2D, ContinuousCollision2D>& bundle) {
+        auto& circle = bundle.get<CircleCollider2D>();
+        hits += sweepBody(collisionLayers, bundle.entity(), bundle.get<core::GlobalTransform2D>(), bundle.get<RigidBody2D>(), circle, circle.radius, deltaTime) ? 1 : 0;
+    });
+
+    runtime.world().deferEnd();
+    util::setProfileCounter("physics.ccd_hits", static_cast<double>(hits));
+}
+
+bool Physics2D::sweepBody (const CollisionLayers2D& collisionLayers, core::Entity entity, core::GlobalTransform2D& transform, const RigidBody2D& body, Collider2D& collider, float sweepRadius, float deltaTime) {
+    auto motion = body.getMomentum() * body.getInvMass() * deltaTime;
+    auto sqMotion = glm::dot(motion, motion);
+
+    // A body moving less than its own radius per step will always be caught by the discrete narrowphase
+    if (sqMotion <= sweepRadius * sweepRadius) {
+        return false;
+    }
+
+    // Motion has already been applied this step
+    auto start = collider.currentPos - motion;
+    auto sweptCentre = start + motion * 0.5f;
+    auto sweptRadius = glm::sqrt(sqMotion) * 0.5f + sweepRadius;
+
+    auto shouldSweep = [&] (core::Entity other, const Collider2D& otherCollider) {
+        // Triggers never stop a body
+        if (other.id() == entity.id() || !collisionLayers.shouldCollide(collider.layers, collider.mask, otherCollider.layers, otherCollider.mask) ||
+            collisionLayers.isTrigger(collider.layers) || collisionLayers.isTrigger(otherCollider.layers)) {
+            return false;
+        }
+
+        auto disp = otherCollider.currentPos - sweptCentre;
+        auto radiusSum = sweptRadius + otherCollider.outerRadius;
+        return glm::dot(disp, disp) < radiusSum * radiusSum;
+    };
+
+    float timeOfImpact = 1.0f;
+    boxQuery.each([&] (const core::Bundle<BoxCollider2D>& bundle) {
+        auto& box = bundle.get<BoxCollider2D>();
+        if (!shouldSweep(bundle.entity(), box)) {
+            return;
+        }
+
+        sweepBox(start, motion, sweepRadius, box.currentPos, box.frameTransform).ifPresent([&] (SweepHit2D hit) {
+            timeOfImpact = glm::min(timeOfImpact, hit.time);
+        });
+    });
+
+    circleQuery.each([&] (const core::Bundle<CircleCollider2D>& bundle) {
+        auto& circle = bundle.get<CircleCollider2D>();
+        if (!shouldSweep(bundle.entity(), circle)) {
+            return;
+        }
+
+        sweepCircle(start, motion, sweepRadius, circle.currentPos, circle.radius).ifPresent([&] (SweepHit2D hit) {
+            timeOfImpact = glm::min(timeOfImpact, hit.time);
+        });
+    });
+
+    if (timeOfImpact >= 1.0f) {
+        return false;
+    }
+
+    // Rewind to the first impact. The rest of the step's motion is dropped and the contact resolves the collision.
+    auto newPos = start + motion * timeOfImpact + glm::normalize(motion) * sweepRadius * CCD_PENETRATION;
+    transform.transform2D.translate(newPos - collider.currentPos);
+    collider.currentPos = newPos;
+
+    return true;
+}
+
+void Physics2D::collisionCheck (core::PhenylRuntime& runtime) {
+    auto& constraints = runtime.resource<Constraints2D>();
+    const auto& collisionLayers = runtime.resource<CollisionLayers2D>();
+    auto& events = runtime.resource<CollisionEvents2D>();
+    auto deltaTime = static_cast<float>(runtime.resource<core::FixedDelta>()());
+
+    // Keep component pointers valid until all pairs have been resolved
+    runtime.world().defer();
+    events.beginStep();
+
+    auto reducedStep = runtime.world().reducedStep();
+    boxBuckets.clear();
+    boxQuery.each([&] (const core::Bundle<BoxCollider2D>& bundle) {
+        if (reducedStep) {
+            prepareReducedCollider(bundle.entity(), bundle.get<BoxCollider2D>());
+        }
+        boxBuckets.add(bundle.entity(), bundle.get<BoxCollider2D>());
+    });
+    circleBuckets.clear();
+    circleQuery.each([&] (const core::Bundle<CircleCollider2D>& bundle) {
+        if (reducedStep) {
+            prepareReducedCollider(bundle.entity(), bundle.get<CircleCollider2D>());
+        }
+        circleBuckets.add(bundle.entity(), bundle.get<CircleCollider2D>());
+    });
+
+    std::size_t candidates = 0;
+    std::size_t narrowphasePairs = 0;
+    std::size_t contacts = 0;
+    constraints.bodies.clear();
+    boxPairs.clear();
+    satBatch.clear();
+    boxBuckets.pairs(collisionLayers, [&] (const auto& entry1, const auto& entry2, bool isTrigger) {
+        candidates++;
+        auto& box1 = *entry1.collider;
+        auto& box2 = *entry2.collider;
+        if (!box1.boundsOverlap(box2)) {
+            return;
+        }
+
+        narrowphasePairs++;
+        boxPairs.emplace_back(BoxPair{entry1.entity, entry2.entity, &box1, &box2, isTrigger});
+        satBatch.push(box1.getDisplacement(box2), box1.frameTransform, box2.frameTransform);
+    });
+
+    satBatch.run();
+
+    for (std::size_t i = 0; i < boxPairs.size(); i++) {
+        auto& [entity1, entity2, box1, box2, isTrigger] = boxPairs[i];
+
+        PHENYL_DEBUG({
+            // Batched kernel should agree with reference SAT implementation
+            auto reference = box1->collide(*box2);
+            PHENYL_DASSERT(static_cast<bool>(reference) == satBatch.collided(i));
+            reference.ifPresent([&] (SATResult2D result) {
+                PHENYL_DASSERT_MSG(glm::abs(result.depth - satBatch.depth(i)) < 1e-4f && glm::length(result.normal - satBatch.normal(i)) < 1e-3f,
+                    "SAT batch mismatch: expected ({}, {}), got ({}, {})", result.normal, result.depth, satBatch.normal(i), satBatch.depth(i));
+            });
+        })
+
+        if (!satBatch.collided(i)) {
+            continue;
+        }
+
+        contacts++;
+        SATResult2D result{.normal=satBatch.normal(i), .depth=satBatch.depth(i)};
+        // No manifold for triggers, approximate the contact point
+        auto contactPoint = isTrigger ? (box1->currentPos + box2->currentPos) / 2.0f : ResolveBoxCollision(constraints, deltaTime, *box1, *box2, result);
+        raiseCollision(events, entity1, entity2, *box1, *box2, contactPoint, result.normal, isTrigger);
+    }
+
+    circleBuckets.pairs(collisionLayers, [&] (const auto& entry1, const auto& entry2, bool isTrigger) {
+        candidates++;
+        auto& circle1 = *entry1.collider;
+        auto& circle2 = *entry2.collider;
+        if (!circle1.boundsOverlap(circle2)) {
+            return;
+        }
+
+        narrowphasePairs++;
+        circle1.collide(circle2).ifPresent([&] (SATResult2D result) {
+            contacts++;
+            auto contactPoint = isTrigger ? circle1.getContactPoint(result) : ResolveCircleCollision(constraints, deltaTime, circle1, circle2, result);
+            raiseCollision(events, entry1.entity, entry2.entity, circle1, circle2, contactPoint, result.normal, isTrigger);
+        });
+    });
+
+    circleBuckets.crossPairs(boxBuckets, collisionLayers, [&] (const auto& circleEntry, const auto& boxEntry, bool isTrigger) {
+        candidates++;
+        auto& circle = *circleEntry.collider;
+        auto& box = *boxEntry.collider;
+        if (circleEntry.entity.id() == boxEntry.entity.id() || !circle.boundsOverlap(box)) {
+            return;
+        }
+
+        narrowphasePairs++;
+        circle.collide(box).ifPresent([&] (SATResult2D result) {
+            contacts++;
+            auto contactPoint = isTrigger ? circle.getContactPoint(result) : ResolveCircleCollision(constraints, deltaTime, circle, box, result);
+            raiseCollision(events, circleEntry.entity, boxEntry.entity, circle, box, contactPoint, result.normal, isTrigger);
+        });
+    });
+
+    // Solver bodies have been built, so reduced bodies can act as static again until their next reduced step
+    for (auto* collider : reducedColliders) {
+        collider->syncStatic(collider->currentPos);
+    }
+    reducedColliders.clear();
+
+    events.endStep([&] (core::EntityId id) {
+        auto entity = runtime.world().entity(id);
+        return entity.exists() && (reducedStep ? !entity.has<core::Reduced>() : entity.has<core::Frozen>());
+    });
+
+    // Snapshot for spatial queries until the next step
+    auto& queries = runtime.resource<SpatialQueries2D>();
+    queries.clear();
+    boxBuckets.each([&] (const auto& entry) {
+        queries.addBox(entry.entity, entry.collider->currentPos, entry.collider->outerRadius, entry.collider->layers, entry.collider->frameTransform);
+    });
+    circleBuckets.each([&] (const auto& entry) {
+        queries.addCircle(entry.entity, entry.collider->currentPos, entry.collider->layers, entry.collider->radius);
+    });
+
+    runtime.world().deferEnd();
+    util::setProfileCounter("physics.broadphase_candidates", static_cast<double>(candidates));
+    util::setProfileCounter("physics.narrowphase_pairs", static_cast<double>(narrowphasePairs));
+    util::setProfileCounter("physics.contacts", static_cast<double>(contacts));
+}
+
+// Only reduced bodies are simulated in a reduced step, so every other body acts as static until the next normal step
+// syncs it again
+void Physics2D::prepareReducedCollider (core::Entity entity, Collider2D& collider) {
+    if (!entity.has<RigidBody2D>()) {
+        return;
+    }
+
+    if (entity.has<core::Reduced>()) {
+        reducedColliders.emplace_back(&collider);
+    } else if (!collider.isStatic()) {
+        collider.syncStatic(collider.currentPos);
+    }
+}
+
+void Physics2D::raiseCollision (CollisionEvents2D& events, core::Entity entity1, core::Entity entity2, const Collider2D& coll1, const Collider2D& coll2, glm::vec2 contactPoint, glm::vec2 normal, bool isTrigger) {
+    events.onContact(entity1.id(), entity2.id(), coll1.layers, coll2.layers, contactPoint, normal, isTrigger);
+    if (!events.raiseSignals) {
+        return;
+    }
+
+    if (coll1.layers & coll2.mask) {
+        //manager._signal<OnCollision>(entity2.id(), entity1.id(), (std::uint32_t)(box1.layers & box2.mask));
+        entity2.raise(OnCollision{entity1.id(), (std::uint32_t)(coll1.layers & coll2.mask), contactPoint, -normal});
+        //events.emplace_back(info2.id(), info1.id(), box1.layers & box2.mask);
+    }
+
+    if (coll2.layers & coll1.mask) {
+        //manager.signal<OnCollision>(entity1.id(), entity2.id(), (std::uint32_t)(box2.layers & box1.mask));
+        entity1.raise(OnCollision{entity2.id(), (std::uint32_t)(coll2.layers & coll1.mask), contactPoint, normal});
+        //events.emplace_back(info1.id(), info2.id(), box2.layers & box1.mask);
+    }
 }
 
 void Physics2D::debugRender (core::World& world) {
@@ -133,4 +536,16 @@ void Physics2D::debugRender (core::World& world) {
 
         core::debugWorldRectOutline(pos1, pos2, pos3, pos4, {0, 0, 1, 1});
     });
+
+    world.query<core::GlobalTransform2D, CircleCollider2D>().each([] (const core::GlobalTransform2D& transform, const CircleCollider2D& circle) {
+        auto centre = transform.transform2D.position();
+        auto prev = centre + glm::vec2{circle.getRadius(), 0};
+        for (auto i = 1; i <= CIRCLE_DEBUG_SEGMENTS; i++) {
+            auto angle = 2.0f * glm::pi<float>() * static_cast<float>(i) / CIRCLE_DEBUG_SEGMENTS;
+            auto next = centre + glm::vec2{glm::cos(angle), glm::sin(angle)} * circle.getRadius();
+
+            core::debugWorldLine(prev, next, {0, 0, 1, 1});
+            prev = next;
+        }
+    });
 }
\ No newline at end of file
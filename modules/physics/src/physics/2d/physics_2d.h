@@ -1,15 +1,48 @@
 #pragma once
 
 #include "physics/physics.h"
+#include "physics/components/2D/rigid_body.h"
+#include "physics/components/2D/continuous_collision.h"
+#include "physics/components/2D/colliders/box_collider.h"
+#include "physics/components/2D/colliders/circle_collider.h"
 #include "core/world.h"
+#include "physics/collision_events.h"
+#include "core/components/2d/global_transform.h"
 
+#include "broadphase_2d.h"
+#include "sat_batch_2d.h"
 
 namespace phenyl::physics {
     class Physics2D {
     private:
+        struct BoxPair {
+            core::Entity entity1;
+            core::Entity entity2;
+            BoxCollider2D* box1;
+            BoxCollider2D* box2;
+            bool isTrigger;
+        };
+
+        core::Query<BoxCollider2D> boxQuery;
+        core::Query<CircleCollider2D> circleQuery;
+        core::Query<core::GlobalTransform2D, RigidBody2D, BoxCollider2D, ContinuousCollision2D> fastBoxQuery;
+        core::Query<core::GlobalTransform2D, RigidBody2D, CircleCollider2D, ContinuousCollision2D> fastCircleQuery;
+        LayerBuckets2D<BoxCollider2D> boxBuckets;
+        LayerBuckets2D<CircleCollider2D> circleBuckets;
+        std::vector<BoxPair> boxPairs;
+        SATBatch2D satBatch;
+        // Bodies simulated in the current reduced step, frozen again once their constraints are built
+        std::vector<Collider2D*> reducedColliders;
+
+        void continuousCollision (core::PhenylRuntime& runtime);
+        bool sweepBody (const CollisionLayers2D& collisionLayers, core::Entity entity, core::GlobalTransform2D& transform, const RigidBody2D& body, Collider2D& collider, float sweepRadius, float deltaTime);
+        void collisionCheck (core::PhenylRuntime& runtime);
+        void prepareReducedCollider (core::Entity entity, Collider2D& collider);
+        static void raiseCollision (CollisionEvents2D& events, core::Entity entity1, core::Entity entity2, const Collider2D& coll1, const Collider2D& coll2, glm::vec2 contactPoint, glm::vec2 normal, bool isTrigger);
+        static void CheckSATBatch ();
     public:
         void addComponents(core::PhenylRuntime& runtime);
 
         void debugRender (core::World& world);
     };
-}
\ No newline at end of file
+}
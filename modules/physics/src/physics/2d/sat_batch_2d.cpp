@@ -0,0 +1,420 @@
+#include <cmath>
+#include <limits>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define PHENYL_SAT_AVX
+#define PHENYL_SAT_SSE
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define PHENYL_SAT_SSE
+#endif
+
+#include "sat_batch_2d.h"
+
+using namespace phenyl::physics;
+
+namespace {
+    struct SATBatchData {
+        const float* dispX;
+        const float* dispY;
+        const float* box1[4];
+        const float* box2[4];
+
+        float* normalX;
+        float* normalY;
+        float* depth;
+    };
+
+    struct ScalarLane {
+        using Mask = bool;
+        static constexpr std::size_t WIDTH = 1;
+
+        float val;
+
+        static ScalarLane Load (const float* ptr) {
+            return {*ptr};
+        }
+
+        static ScalarLane Broadcast (float f) {
+            return {f};
+        }
+
+        void store (float* ptr) const {
+            *ptr = val;
+        }
+
+        friend ScalarLane operator+ (ScalarLane a, ScalarLane b) {
+            return {a.val + b.val};
+        }
+
+        friend ScalarLane operator- (ScalarLane a, ScalarLane b) {
+            return {a.val - b.val};
+        }
+
+        friend ScalarLane operator* (ScalarLane a, ScalarLane b) {
+            return {a.val * b.val};
+        }
+
+        friend ScalarLane operator/ (ScalarLane a, ScalarLane b) {
+            return {a.val / b.val};
+        }
+
+        friend ScalarLane operator- (ScalarLane a) {
+            return {-a.val};
+        }
+
+        static ScalarLane Sqrt (ScalarLane a) {
+            return {std::sqrt(a.val)};
+        }
+
+        static ScalarLane Abs (ScalarLane a) {
+            return {std::abs(a.val)};
+        }
+
+        static Mask Less (ScalarLane a, ScalarLane b) {
+            return a.val < b.val;
+        }
+
+        static Mask LessEq (ScalarLane a, ScalarLane b) {
+            return a.val <= b.val;
+        }
+
+        static Mask GreaterEq (ScalarLane a, ScalarLane b) {
+            return a.val >= b.val;
+        }
+
+        static ScalarLane Select (Mask mask, ScalarLane a, ScalarLane b) {
+            return mask ? a : b;
+        }
+
+        static Mask None () {
+            return false;
+        }
+
+        static Mask And (Mask a, Mask b) {
+            return a && b;
+        }
+
+        static Mask Or (Mask a, Mask b) {
+            return a || b;
+        }
+
+        static Mask Not (Mask a) {
+            return !a;
+        }
+
+        static bool All (Mask a) {
+            return a;
+        }
+    };
+
+#ifdef PHENYL_SAT_SSE
+    struct SSELane {
+        using Mask = __m128;
+        static constexpr std::size_t WIDTH = 4;
+
+        __m128 val;
+
+        static SSELane Load (const float* ptr) {
+            return {_mm_loadu_ps(ptr)};
+        }
+
+        static SSELane Broadcast (float f) {
+            return {_mm_set1_ps(f)};
+        }
+
+        void store (float* ptr) const {
+            _mm_storeu_ps(ptr, val);
+        }
+
+        friend SSELane operator+ (SSELane a, SSELane b) {
+            return {_mm_add_ps(a.val, b.val)};
+        }
+
+        friend SSELane operator- (SSELane a, SSELane b) {
+            return {_mm_sub_ps(a.val, b.val)};
+        }
+
+        friend SSELane operator* (SSELane a, SSELane b) {
+            return {_mm_mul_ps(a.val, b.val)};
+        }
+
+        friend SSELane operator/ (SSELane a, SSELane b) {
+            return {_mm_div_ps(a.val, b.val)};
+        }
+
+        friend SSELane operator- (SSELane a) {
+            return {_mm_xor_ps(a.val, _mm_set1_ps(-0.0f))};
+        }
+
+        static SSELane Sqrt (SSELane a) {
+            return {_mm_sqrt_ps(a.val)};
+        }
+
+        static SSELane Abs (SSELane a) {
+            return {_mm_andnot_ps(_mm_set1_ps(-0.0f), a.val)};
+        }
+
+        static Mask Less (SSELane a, SSELane b) {
+            return _mm_cmplt_ps(a.val, b.val);
+        }
+
+        static Mask LessEq (SSELane a, SSELane b) {
+            return _mm_cmple_ps(a.val, b.val);
+        }
+
+        static Mask GreaterEq (SSELane a, SSELane b) {
+            return _mm_cmpge_ps(a.val, b.val);
+        }
+
+        static SSELane Select (Mask mask, SSELane a, SSELane b) {
+            // SSE2 has no blendv
+            return {_mm_or_ps(_mm_and_ps(mask, a.val), _mm_andnot_ps(mask, b.val))};
+        }
+
+        static Mask None () {
+            return _mm_setzero_ps();
+        }
+
+        static Mask And (Mask a, Mask b) {
+            return _mm_and_ps(a, b);
+        }
+
+        static Mask Or (Mask a, Mask b) {
+            return _mm_or_ps(a, b);
+        }
+
+        static Mask Not (Mask a) {
+            return _mm_xor_ps(a, _mm_castsi128_ps(_mm_set1_epi32(-1)));
+        }
+
+        static bool All (Mask a) {
+            return _mm_movemask_ps(a) == 0xF;
+        }
+    };
+#endif
+
+#ifdef PHENYL_SAT_AVX
+    struct AVXLane {
+        using Mask = __m256;
+        static constexpr std::size_t WIDTH = 8;
+
+        __m256 val;
+
+        static AVXLane Load (const float* ptr) {
+            return {_mm256_loadu_ps(ptr)};
+        }
+
+        static AVXLane Broadcast (float f) {
+            return {_mm256_set1_ps(f)};
+        }
+
+        void store (float* ptr) const {
+            _mm256_storeu_ps(ptr, val);
+        }
+
+        friend AVXLane operator+ (AVXLane a, AVXLane b) {
+            return {_mm256_add_ps(a.val, b.val)};
+        }
+
+        friend AVXLane operator- (AVXLane a, AVXLane b) {
+            return {_mm256_sub_ps(a.val, b.val)};
+        }
+
+        friend AVXLane operator* (AVXLane a, AVXLane b) {
+            return {_mm256_mul_ps(a.val, b.val)};
+        }
+
+        friend AVXLane operator/ (AVXLane a, AVXLane b) {
+            return {_mm256_div_ps(a.val, b.val)};
+        }
+
+        friend AVXLane operator- (AVXLane a) {
+            return {_mm256_xor_ps(a.val, _mm256_set1_ps(-0.0f))};
+        }
+
+        static AVXLane Sqrt (AVXLane a) {
+            return {_mm256_sqrt_ps(a.val)};
+        }
+
+        static AVXLane Abs (AVXLane a) {
+            return {_mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.val)};
+        }
+
+        static Mask Less (AVXLane a, AVXLane b) {
+            return _mm256_cmp_ps(a.val, b.val, _CMP_LT_OQ);
+        }
+
+        static Mask LessEq (AVXLane a, AVXLane b) {
+            return _mm256_cmp_ps(a.val, b.val, _CMP_LE_OQ);
+        }
+
+        static Mask GreaterEq (AVXLane a, AVXLane b) {
+            return _mm256_cmp_ps(a.val, b.val, _CMP_GE_OQ);
+        }
+
+        static AVXLane Select (Mask mask, AVXLane a, AVXLane b) {
+            return {_mm256_blendv_ps(b.val, a.val, mask)};
+        }
+
+        static Mask None () {
+            return _mm256_setzero_ps();
+        }
+
+        static Mask And (Mask a, Mask b) {
+            return _mm256_and_ps(a, b);
+        }
+
+        static Mask Or (Mask a, Mask b) {
+            return _mm256_or_ps(a, b);
+        }
+
+        static Mask Not (Mask a) {
+            return _mm256_xor_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(-1)));
+        }
+
+        static bool All (Mask a) {
+            return _mm256_movemask_ps(a) == 0xFF;
+        }
+    };
+#endif
+
+    template <typename L>
+    struct SATLaneState {
+        typename L::Mask separated = L::None();
+        L minSep = L::Broadcast(std::numeric_limits<float>::max());
+        L minSepSq = L::Broadcast(std::numeric_limits<float>::max());
+        L normalX = L::Broadcast(0.0f);
+        L normalY = L::Broadcast(0.0f);
+    };
+
+    // Lane-wise equivalent of testAxisNew() in box_collider.cpp. Projecting the four corners of the other box
+    // is reduced to projecting its centre and its half-extent along the axis.
+    template <typename L>
+    inline void TestAxis (SATLaneState<L>& state, L axisX, L axisY, L dispX, L dispY, const L (&other)[4], bool negateNormal) {
+        auto axisLen = L::Sqrt(axisX * axisX + axisY * axisY);
+        auto normX = axisX / axisLen;
+        auto normY = axisY / axisLen;
+
+        auto centre = normX * dispX + normY * dispY;
+        auto radius = L::Abs(normX * other[0] + normY * other[1]) + L::Abs(normX * other[2] + normY * other[3]);
+        auto minAxis = centre - radius;
+        auto maxAxis = centre + radius;
+
+        state.separated = L::Or(state.separated, L::Or(L::GreaterEq(minAxis, axisLen), L::LessEq(maxAxis, -axisLen)));
+
+        auto minDisp = axisLen - minAxis;
+        auto maxDisp = (-axisLen) - maxAxis;
+        auto sep = L::Select(L::LessEq(minDisp, -maxDisp), minDisp, maxDisp);
+        auto sepSq = sep * sep;
+
+        auto better = L::Less(sepSq, state.minSepSq);
+        state.minSep = L::Select(better, sep, state.minSep);
+        state.minSepSq = L::Select(better, sepSq, state.minSepSq);
+        state.normalX = L::Select(better, negateNormal ? -normX : normX, state.normalX);
+        state.normalY = L::Select(better, negateNormal ? -normY : normY, state.normalY);
+    }
+
+    template <typename L>
+    void Evaluate (const SATBatchData& data, std::size_t i) {
+        auto dispX = L::Load(data.dispX + i);
+        auto dispY = L::Load(data.dispY + i);
+        L box1[4] = {L::Load(data.box1[0] + i), L::Load(data.box1[1] + i), L::Load(data.box1[2] + i), L::Load(data.box1[3] + i)};
+        L box2[4] = {L::Load(data.box2[0] + i), L::Load(data.box2[1] + i), L::Load(data.box2[2] + i), L::Load(data.box2[3] + i)};
+
+        auto zero = L::Broadcast(0.0f);
+        SATLaneState<L> state{};
+
+        // Box 1 axes
+        TestAxis(state, box1[0], box1[1], dispX, dispY, box2, false);
+        TestAxis(state, box1[2], box1[3], dispX, dispY, box2, false);
+
+        if (L::All(state.separated)) {
+            zero.store(data.normalX + i);
+            zero.store(data.normalY + i);
+            zero.store(data.depth + i);
+            return;
+        }
+
+        // Box 2 axes
+        TestAxis(state, box2[0], box2[1], -dispX, -dispY, box1, true);
+        TestAxis(state, box2[2], box2[3], -dispX, -dispY, box1, true);
+
+        auto flip = L::Less(state.minSep, zero);
+        auto depth = L::Select(flip, -state.minSep, state.minSep);
+        auto normalX = L::Select(flip, -state.normalX, state.normalX);
+        auto normalY = L::Select(flip, -state.normalY, state.normalY);
+
+        auto valid = L::And(L::Not(state.separated), L::Less(L::Broadcast(std::numeric_limits<float>::epsilon()), state.minSepSq));
+        L::Select(valid, normalX, zero).store(data.normalX + i);
+        L::Select(valid, normalY, zero).store(data.normalY + i);
+        L::Select(valid, depth, zero).store(data.depth + i);
+    }
+}
+
+#if defined(PHENYL_SAT_AVX)
+const std::size_t SATBatch2D::LANE_WIDTH = AVXLane::WIDTH;
+#elif defined(PHENYL_SAT_SSE)
+const std::size_t SATBatch2D::LANE_WIDTH = SSELane::WIDTH;
+#else
+const std::size_t SATBatch2D::LANE_WIDTH = ScalarLane::WIDTH;
+#endif
+
+void SATBatch2D::push (glm::vec2 disp, const glm::mat2& box1Transform, const glm::mat2& box2Transform) {
+    dispX.emplace_back(disp.x);
+    dispY.emplace_back(disp.y);
+
+    for (auto i = 0; i < 4; i++) {
+        box1Mat[i].emplace_back(box1Transform[i / 2][i % 2]);
+        box2Mat[i].emplace_back(box2Transform[i / 2][i % 2]);
+    }
+}
+
+void SATBatch2D::clear () {
+    dispX.clear();
+    dispY.clear();
+
+    for (auto i = 0; i < 4; i++) {
+        box1Mat[i].clear();
+        box2Mat[i].clear();
+    }
+
+    normalX.clear();
+    normalY.clear();
+    depths.clear();
+}
+
+void SATBatch2D::run () {
+    normalX.resize(size());
+    normalY.resize(size());
+    depths.resize(size());
+
+    SATBatchData data{
+        .dispX = dispX.data(),
+        .dispY = dispY.data(),
+        .box1 = {box1Mat[0].data(), box1Mat[1].data(), box1Mat[2].data(), box1Mat[3].data()},
+        .box2 = {box2Mat[0].data(), box2Mat[1].data(), box2Mat[2].data(), box2Mat[3].data()},
+        .normalX = normalX.data(),
+        .normalY = normalY.data(),
+        .depth = depths.data()
+    };
+
+    std::size_t i = 0;
+#ifdef PHENYL_SAT_AVX
+    for (; i + AVXLane::WIDTH <= size(); i += AVXLane::WIDTH) {
+        Evaluate<AVXLane>(data, i);
+    }
+#endif
+
+#ifdef PHENYL_SAT_SSE
+    for (; i + SSELane::WIDTH <= size(); i += SSELane::WIDTH) {
+        Evaluate<SSELane>(data, i);
+    }
+#endif
+
+    // Scalar fallback for the remainder
+    for (; i < size(); i++) {
+        Evaluate<ScalarLane>(data, i);
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "graphics/maths_headers.h"
+
+namespace phenyl::physics {
+    // Batched box vs box SAT narrowphase. Inputs and outputs are stored as SoA so that pairs can be evaluated
+    // LANE_WIDTH at a time. BoxCollider2D::collide() remains the reference implementation.
+    class SATBatch2D {
+    private:
+        // Displacement from box 1 to box 2
+        std::vector<float> dispX;
+        std::vector<float> dispY;
+
+        // Frame transforms, column major (m[0][0], m[0][1], m[1][0], m[1][1])
+        std::vector<float> box1Mat[4];
+        std::vector<float> box2Mat[4];
+
+        std::vector<float> normalX;
+        std::vector<float> normalY;
+        std::vector<float> depths;
+    public:
+        static const std::size_t LANE_WIDTH;
+
+        void push (glm::vec2 disp, const glm::mat2& box1Transform, const glm::mat2& box2Transform);
+        void clear ();
+
+        // Evaluates every pushed pair, overwriting previous results
+        void run ();
+
+        [[nodiscard]] std::size_t size () const noexcept {
+            return dispX.size();
+        }
+
+        [[nodiscard]] bool collided (std::size_t index) const noexcept {
+            return depths[index] > 0.0f;
+        }
+
+        [[nodiscard]] glm::vec2 normal (std::size_t index) const noexcept {
+            return glm::vec2{normalX[index], normalY[index]};
+        }
+
+        [[nodiscard]] float depth (std::size_t index) const noexcept {
+            return depths[index];
+        }
+    };
+}
@@ -0,0 +1,60 @@
+#include "physics/components/2D/rigid_body.h"
+
+#include "solver_bodies_2d.h"
+
+using namespace phenyl::physics;
+
+SolverBodies2D::SolverBodies2D () {
+    clear();
+}
+
+std::size_t SolverBodies2D::add (Collider2D& collider) {
+    if (!collider.isDynamic()) {
+        return STATIC_BODY;
+    }
+
+    if (collider.solverStep == step) {
+        return collider.solverIndex;
+    }
+
+    auto index = size();
+    velocities.emplace_back(collider.momentum * collider.invMass);
+    angularVelocities.emplace_back(collider.angularMomentum * collider.invInertiaMoment);
+    invMasses.emplace_back(collider.invMass);
+    invInertias.emplace_back(collider.invInertiaMoment);
+    impulses.emplace_back(0.0f, 0.0f);
+    angularImpulses.emplace_back(0.0f);
+
+    collider.solverStep = step;
+    collider.solverIndex = index;
+
+    return index;
+}
+
+void SolverBodies2D::clear () {
+    velocities.clear();
+    angularVelocities.clear();
+    invMasses.clear();
+    invInertias.clear();
+    impulses.clear();
+    angularImpulses.clear();
+
+    // Invalidates indices stored in colliders
+    step++;
+
+    velocities.emplace_back(0.0f, 0.0f);
+    angularVelocities.emplace_back(0.0f);
+    invMasses.emplace_back(0.0f);
+    invInertias.emplace_back(0.0f);
+    impulses.emplace_back(0.0f, 0.0f);
+    angularImpulses.emplace_back(0.0f);
+}
+
+void SolverBodies2D::writeBack (const Collider2D& collider, RigidBody2D& body) const {
+    if (collider.solverStep != step || collider.solverIndex == STATIC_BODY) {
+        return;
+    }
+
+    body.applyImpulse(impulses[collider.solverIndex]);
+    body.applyAngularImpulse(angularImpulses[collider.solverIndex]);
+}
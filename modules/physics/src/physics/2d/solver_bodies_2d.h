@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "graphics/maths_headers.h"
+#include "physics/components/2D/collider.h"
+
+namespace phenyl::physics {
+    // Dense SoA copy of the colliders taking part in constraints this step. Constraints refer to bodies by index, so
+    // the solver never touches archetype storage.
+    class SolverBodies2D {
+    private:
+        std::vector<glm::vec2> velocities;
+        std::vector<float> angularVelocities;
+        std::vector<float> invMasses;
+        std::vector<float> invInertias;
+
+        std::vector<glm::vec2> impulses;
+        std::vector<float> angularImpulses;
+
+        std::uint64_t step = 1;
+    public:
+        // Shared by every collider with infinite mass and inertia. Its velocity is always zero and it is never written to.
+        static constexpr std::size_t STATIC_BODY = 0;
+
+        SolverBodies2D ();
+
+        // Returns the index of the collider, gathering it if it has not been gathered this step
+        std::size_t add (Collider2D& collider);
+        void clear ();
+
+        [[nodiscard]] std::size_t size () const noexcept {
+            return velocities.size();
+        }
+
+        [[nodiscard]] glm::vec2 velocity (std::size_t index) const noexcept {
+            return velocities[index];
+        }
+
+        [[nodiscard]] float angularVelocity (std::size_t index) const noexcept {
+            return angularVelocities[index];
+        }
+
+        void applyImpulse (std::size_t index, glm::vec2 impulse, float angularImpulse) {
+            if (index == STATIC_BODY) {
+                return;
+            }
+
+            velocities[index] += impulse * invMasses[index];
+            angularVelocities[index] += angularImpulse * invInertias[index];
+
+            impulses[index] += impulse;
+            angularImpulses[index] += angularImpulse;
+        }
+
+        // Applies the impulses accumulated by the solver for this collider, if it took part in any constraints
+        void writeBack (const Collider2D& collider, RigidBody2D& body) const;
+    };
+}
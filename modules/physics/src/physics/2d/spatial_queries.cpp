@@ -0,0 +1,223 @@
+#include <algorithm>
+
+#include "core/runtime/thread_pool.h"
+#include "logging/logging.h"
+#include "physics/spatial_queries.h"
+
+#include "sweep_2d.h"
+
+#define RAYCAST_MIN_CHUNK 16
+
+using namespace phenyl::physics;
+
+SpatialQueries2D::SpatialQueries2D (core::ThreadPool& threadPool) : threadPool{threadPool} {}
+
+void SpatialQueries2D::clear () {
+    for (auto& bucket : buckets) {
+        bucket.colliders.clear();
+    }
+}
+
+SpatialQueries2D::QueryBucket& SpatialQueries2D::getBucket (std::uint64_t layers) {
+    for (auto& bucket : buckets) {
+        if (bucket.layers == layers) {
+            return bucket;
+        }
+    }
+
+    return buckets.emplace_back(QueryBucket{.layers=layers, .colliders={}});
+}
+
+void SpatialQueries2D::addBox (core::Entity entity, glm::vec2 position, float outerRadius, std::uint64_t layers, const glm::mat2& frameTransform) {
+    getBucket(layers).colliders.emplace_back(QueryCollider{
+        .entity=entity,
+        .position=position,
+        .outerRadius=outerRadius,
+        .frameTransform=frameTransform,
+        .radius=0.0f,
+        .isBox=true
+    });
+}
+
+void SpatialQueries2D::addCircle (core::Entity entity, glm::vec2 position, std::uint64_t layers, float radius) {
+    getBucket(layers).colliders.emplace_back(QueryCollider{
+        .entity=entity,
+        .position=position,
+        .outerRadius=radius,
+        .frameTransform=glm::mat2{1.0f},
+        .radius=radius,
+        .isBox=false
+    });
+}
+
+phenyl::util::Optional<QueryHit2D> SpatialQueries2D::raycast (glm::vec2 origin, glm::vec2 direction, float maxDistance, std::uint64_t mask) const {
+    return circleCast(origin, 0.0f, direction, maxDistance, mask);
+}
+
+phenyl::util::Optional<QueryHit2D> SpatialQueries2D::raycast (const Ray2D& ray) const {
+    return raycast(ray.origin, ray.direction, ray.maxDistance, ray.mask);
+}
+
+phenyl::util::Optional<QueryHit2D> SpatialQueries2D::circleCast (glm::vec2 origin, float radius, glm::vec2 direction, float maxDistance, std::uint64_t mask) const {
+    auto dirLength = glm::length(direction);
+    if (dirLength <= std::numeric_limits<float>::epsilon() || maxDistance <= 0.0f) {
+        return util::NullOpt;
+    }
+
+    auto motion = direction / dirLength * maxDistance;
+    auto sweptCentre = origin + motion * 0.5f;
+    auto sweptRadius = maxDistance * 0.5f + radius;
+
+    const QueryCollider* closest = nullptr;
+    SweepHit2D closestHit{.time=std::numeric_limits<float>::max(), .normal={0, 0}};
+    for (const auto& bucket : buckets) {
+        if (!(bucket.layers & mask)) {
+            continue;
+        }
+
+        for (const auto& collider : bucket.colliders) {
+            auto disp = collider.position - sweptCentre;
+            auto radiusSum = sweptRadius + collider.outerRadius;
+            if (glm::dot(disp, disp) >= radiusSum * radiusSum) {
+                continue;
+            }
+
+            auto hit = collider.isBox ? sweepBox(origin, motion, radius, collider.position, collider.frameTransform) : sweepCircle(origin, motion, radius, collider.position, collider.radius);
+            hit.ifPresent([&] (SweepHit2D sweepHit) {
+                if (sweepHit.time < closestHit.time) {
+                    closest = &collider;
+                    closestHit = sweepHit;
+                }
+            });
+        }
+    }
+
+    if (!closest) {
+        return util::NullOpt;
+    }
+
+    return util::Optional{QueryHit2D{
+        .entity=closest->entity,
+        .point=origin + motion * closestHit.time - closestHit.normal * radius,
+        .normal=closestHit.normal,
+        .distance=closestHit.time * maxDistance
+    }};
+}
+
+void SpatialQueries2D::overlapAABB (glm::vec2 min, glm::vec2 max, std::vector<core::Entity>& results, std::uint64_t mask) const {
+    PHENYL_DASSERT_MSG(min.x <= max.x && min.y <= max.y, "Invalid AABB: min={}, max={}", min, max);
+    results.clear();
+
+    auto centre = (min + max) / 2.0f;
+    auto halfExtents = (max - min) / 2.0f;
+    for (const auto& bucket : buckets) {
+        if (!(bucket.layers & mask)) {
+            continue;
+        }
+
+        for (const auto& collider : bucket.colliders) {
+            // Closest point in the AABB to the collider, checked against its bounding circle
+            auto closestPoint = glm::clamp(collider.position, min, max);
+            auto offset = collider.position - closestPoint;
+            if (glm::dot(offset, offset) >= collider.outerRadius * collider.outerRadius) {
+                continue;
+            }
+
+            if (!collider.isBox) {
+                // Bounding circle is exact for circles
+                results.emplace_back(collider.entity);
+                continue;
+            }
+
+            // SAT on the two world axes and the two box axes
+            auto disp = collider.position - centre;
+            const auto& transform = collider.frameTransform;
+            auto boxExtentX = glm::abs(transform[0].x) + glm::abs(transform[1].x);
+            auto boxExtentY = glm::abs(transform[0].y) + glm::abs(transform[1].y);
+            if (glm::abs(disp.x) >= halfExtents.x + boxExtentX || glm::abs(disp.y) >= halfExtents.y + boxExtentY) {
+                continue;
+            }
+
+            bool separated = false;
+            for (auto i = 0; i < 2 && !separated; i++) {
+                auto boxExtent = glm::length(transform[i]);
+                auto axis = transform[i] / boxExtent;
+                auto aabbExtent = halfExtents.x * glm::abs(axis.x) + halfExtents.y * glm::abs(axis.y);
+
+                separated = glm::abs(glm::dot(disp, axis)) >= boxExtent + aabbExtent;
+            }
+
+            if (!separated) {
+                results.emplace_back(collider.entity);
+            }
+        }
+    }
+}
+
+void SpatialQueries2D::nearest (glm::vec2 point, std::size_t k, std::vector<QueryHit2D>& results, std::uint64_t mask) const {
+    results.clear();
+    if (!k) {
+        return;
+    }
+
+    for (const auto& bucket : buckets) {
+        if (!(bucket.layers & mask)) {
+            continue;
+        }
+
+        for (const auto& collider : bucket.colliders) {
+            auto centreDist = glm::length(point - collider.position);
+            if (results.size() == k && centreDist - collider.outerRadius >= results.back().distance) {
+                // Cannot be closer than the current k nearest
+                continue;
+            }
+
+            QueryHit2D hit{.entity=collider.entity, .point=point, .normal={0, 0}, .distance=0.0f};
+            if (collider.isBox) {
+                glm::vec2 axes[] = {collider.frameTransform[0], collider.frameTransform[1]};
+                float halfExtents[] = {glm::length(axes[0]), glm::length(axes[1])};
+
+                auto disp = point - collider.position;
+                auto closestPoint = collider.position;
+                for (auto i = 0; i < 2; i++) {
+                    auto axis = axes[i] / halfExtents[i];
+                    closestPoint += axis * glm::clamp(glm::dot(disp, axis), -halfExtents[i], halfExtents[i]);
+                }
+
+                auto offset = point - closestPoint;
+                hit.distance = glm::length(offset);
+                if (hit.distance > 0.0f) {
+                    hit.point = closestPoint;
+                    hit.normal = offset / hit.distance;
+                }
+            } else if (centreDist > collider.radius) {
+                hit.normal = (point - collider.position) / centreDist;
+                hit.point = collider.position + hit.normal * collider.radius;
+                hit.distance = centreDist - collider.radius;
+            }
+
+            if (results.size() == k && hit.distance >= results.back().distance) {
+                continue;
+            }
+
+            // Insertion sort, k is expected to be small
+            auto it = std::upper_bound(results.begin(), results.end(), hit.distance, [] (float distance, const QueryHit2D& other) {
+                return distance < other.distance;
+            });
+            results.insert(it, hit);
+            if (results.size() > k) {
+                results.pop_back();
+            }
+        }
+    }
+}
+
+void SpatialQueries2D::raycastBatch (std::span<const Ray2D> rays, std::span<util::Optional<QueryHit2D>> results) const {
+    PHENYL_ASSERT_MSG(rays.size() == results.size(), "Raycast batch size mismatch: {} rays, {} results", rays.size(), results.size());
+
+    threadPool.parallelFor(rays.size(), RAYCAST_MIN_CHUNK, [&] (std::size_t start, std::size_t end) {
+        for (auto i = start; i < end; i++) {
+            results[i] = raycast(rays[i]);
+        }
+    });
+}
@@ -0,0 +1,66 @@
+#include "sweep_2d.h"
+
+using namespace phenyl;
+
+util::Optional<physics::SweepHit2D> physics::sweepCircle (glm::vec2 start, glm::vec2 motion, float radius, glm::vec2 centre, float circleRadius) {
+    // Solve |start + t * motion - centre| = radius + circleRadius for the smallest t
+    auto offset = start - centre;
+    auto radiusSum = radius + circleRadius;
+
+    auto a = glm::dot(motion, motion);
+    auto b = glm::dot(offset, motion);
+    auto c = glm::dot(offset, offset) - radiusSum * radiusSum;
+    if (c <= 0 || a <= std::numeric_limits<float>::epsilon()) {
+        return util::NullOpt;
+    }
+
+    auto discriminant = b * b - a * c;
+    if (discriminant < 0) {
+        return util::NullOpt;
+    }
+
+    auto t = (-b - glm::sqrt(discriminant)) / a;
+    if (t < 0.0f || t > 1.0f) {
+        return util::NullOpt;
+    }
+
+    return util::Optional{SweepHit2D{.time=t, .normal=glm::normalize(offset + motion * t)}};
+}
+
+util::Optional<physics::SweepHit2D> physics::sweepBox (glm::vec2 start, glm::vec2 motion, float radius, glm::vec2 centre, const glm::mat2& frameTransform) {
+    // Slab test in the frame of the box
+    glm::vec2 axes[] = {frameTransform * glm::vec2{1, 0}, frameTransform * glm::vec2{0, 1}};
+    auto offset = start - centre;
+
+    float tMin = -std::numeric_limits<float>::max();
+    float tMax = std::numeric_limits<float>::max();
+    glm::vec2 normal{0, 0};
+    for (auto axis : axes) {
+        auto halfExtent = glm::length(axis);
+        auto normAxis = axis / halfExtent;
+        auto extent = halfExtent + radius;
+
+        auto pos = glm::dot(offset, normAxis);
+        auto vel = glm::dot(motion, normAxis);
+        if (glm::abs(vel) <= std::numeric_limits<float>::epsilon()) {
+            if (glm::abs(pos) >= extent) {
+                return util::NullOpt;
+            }
+            continue;
+        }
+
+        auto t1 = (-extent - pos) / vel;
+        auto t2 = (extent - pos) / vel;
+        if (glm::min(t1, t2) > tMin) {
+            tMin = glm::min(t1, t2);
+            normal = vel > 0 ? -normAxis : normAxis;
+        }
+        tMax = glm::min(tMax, glm::max(t1, t2));
+    }
+
+    if (tMin > tMax || tMin <= 0.0f || tMin > 1.0f) {
+        return util::NullOpt;
+    }
+
+    return util::Optional{SweepHit2D{.time=tMin, .normal=normal}};
+}
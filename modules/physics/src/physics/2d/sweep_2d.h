@@ -0,0 +1,20 @@
+#pragma once
+
+#include "graphics/maths_headers.h"
+#include "util/optional.h"
+
+namespace phenyl::physics {
+    struct SweepHit2D {
+        // Fraction of the motion at first contact, in [0, 1]
+        float time;
+        // Surface normal of the shape that was hit, pointing back towards the swept circle
+        glm::vec2 normal;
+    };
+
+    // First contact of a circle of the given radius moving from start by motion. A radius of 0 is a raycast. Empty if
+    // it never touches the shape or already overlaps it at the start, which is left to the discrete narrowphase.
+    util::Optional<SweepHit2D> sweepCircle (glm::vec2 start, glm::vec2 motion, float radius, glm::vec2 centre, float circleRadius);
+
+    // The box is inflated by radius along its axes, which slightly overestimates the swept shape at the corners
+    util::Optional<SweepHit2D> sweepBox (glm::vec2 start, glm::vec2 motion, float radius, glm::vec2 centre, const glm::mat2& frameTransform);
+}
@@ -15,6 +15,10 @@ bool physics::Collider2D::shouldCollide (const physics::Collider2D& other) const
         return false;
     }
 
+    return boundsOverlap(other);
+}
+
+bool physics::Collider2D::boundsOverlap (const physics::Collider2D& other) const {
     auto displacement = getDisplacement(other);
     float sqDispLen = glm::dot(displacement, displacement);
     float radiusLen = outerRadius + other.outerRadius;
@@ -28,12 +32,14 @@ void physics::Collider2D::syncUpdates (const RigidBody2D& body, glm::vec2 pos) {
     invInertiaMoment = body.getInvInertia();
     momentum = body.getMomentum();
     angularMomentum = body.getAngularMomentum();
-
-    appliedImpulse = {0.0f, 0.0f};
-    appliedAngularImpulse = 0.0f;
+    staticBody = false;
 }
 
-void physics::Collider2D::updateBody (physics::RigidBody2D& body) const {
-    body.applyImpulse(appliedImpulse);
-    body.applyAngularImpulse(appliedAngularImpulse);
+void physics::Collider2D::syncStatic (glm::vec2 pos) {
+    currentPos = pos;
+    invMass = 0.0f;
+    invInertiaMoment = 0.0f;
+    momentum = {0.0f, 0.0f};
+    angularMomentum = 0.0f;
+    staticBody = true;
 }
@@ -0,0 +1,79 @@
+#include "core/serialization/serializer_impl.h"
+
+#include "physics/components/2D/colliders/box_collider.h"
+#include "physics/components/2D/colliders/circle_collider.h"
+#include "physics/2d/collisions_2d.h"
+
+using namespace phenyl;
+
+namespace phenyl::physics {
+    PHENYL_SERIALIZABLE(CircleCollider2D,
+        PHENYL_SERIALIZABLE_INHERITS_NAMED(Collider2D, "Collider2D"),
+        PHENYL_SERIALIZABLE_MEMBER(radius))
+}
+
+void physics::CircleCollider2D::syncUpdates (const RigidBody2D& body, glm::vec2 pos) {
+    Collider2D::syncUpdates(body, pos);
+
+    // Radius may have been deserialized directly
+    setOuterRadius(radius);
+}
+
+void physics::CircleCollider2D::syncStatic (glm::vec2 pos) {
+    Collider2D::syncStatic(pos);
+    setOuterRadius(radius);
+}
+
+util::Optional<physics::SATResult2D> physics::CircleCollider2D::collide (const physics::CircleCollider2D& other) const {
+    auto disp = getDisplacement(other);
+    auto sqDist = glm::dot(disp, disp);
+    auto radiusSum = radius + other.radius;
+
+    if (sqDist >= radiusSum * radiusSum) {
+        return util::NullOpt;
+    }
+
+    auto dist = glm::sqrt(sqDist);
+    // Concentric circles have no well defined normal, so pick an arbitrary one
+    auto normal = dist > std::numeric_limits<float>::epsilon() ? disp / dist : glm::vec2{0, 1};
+
+    return util::Optional{SATResult2D{.normal=normal, .depth=radiusSum - dist}};
+}
+
+util::Optional<physics::SATResult2D> physics::CircleCollider2D::collide (const physics::BoxCollider2D& box) const {
+    // Work in the box's frame, using its normalised axes so that distances are not scaled
+    glm::vec2 axes[] = {box.frameTransform * glm::vec2{1, 0}, box.frameTransform * glm::vec2{0, 1}};
+    float halfExtents[] = {glm::length(axes[0]), glm::length(axes[1])};
+    axes[0] /= halfExtents[0];
+    axes[1] /= halfExtents[1];
+
+    auto disp = -getDisplacement(box);
+    glm::vec2 local = {glm::dot(disp, axes[0]), glm::dot(disp, axes[1])};
+    glm::vec2 closest = {glm::clamp(local.x, -halfExtents[0], halfExtents[0]), glm::clamp(local.y, -halfExtents[1], halfExtents[1])};
+
+    if (local != closest) {
+        // Centre outside box, nearest point is on the boundary
+        auto boxToCircle = local - closest;
+        auto sqDist = glm::dot(boxToCircle, boxToCircle);
+        if (sqDist >= radius * radius) {
+            return util::NullOpt;
+        }
+
+        auto dist = glm::sqrt(sqDist);
+        auto localNormal = boxToCircle / dist;
+        auto normal = axes[0] * localNormal.x + axes[1] * localNormal.y;
+
+        return util::Optional{SATResult2D{.normal=-normal, .depth=radius - dist}};
+    }
+
+    // Centre inside box, push out through the nearest face
+    auto xPen = halfExtents[0] - glm::abs(local.x);
+    auto yPen = halfExtents[1] - glm::abs(local.y);
+    auto normal = xPen <= yPen ? axes[0] * (local.x >= 0 ? 1.0f : -1.0f) : axes[1] * (local.y >= 0 ? 1.0f : -1.0f);
+
+    return util::Optional{SATResult2D{.normal=-normal, .depth=glm::min(xPen, yPen) + radius}};
+}
+
+glm::vec2 physics::CircleCollider2D::getContactPoint (const physics::SATResult2D& result) const {
+    return getPosition() + result.normal * (radius - result.depth / 2.0f);
+}
@@ -0,0 +1,7 @@
+#include "core/serialization/serializer_impl.h"
+
+#include "physics/components/2D/continuous_collision.h"
+
+namespace phenyl::physics {
+    PHENYL_SERIALIZABLE(ContinuousCollision2D)
+}
@@ -4,6 +4,9 @@
 #define MIN_ANGULAR_VEL 0.01f
 #define MAX_ANGULAR_VEL (3.14f * 2.0f)
 
+// Angular velocity is in radians per step of the default 60 Hz physics rate
+#define ANGULAR_REFERENCE_STEP (1.0f / 60.0f)
+
 using namespace phenyl::physics;
 
 namespace phenyl::physics {
@@ -32,7 +35,7 @@ void RigidBody2D::doMotion (core::GlobalTransform2D& transform2D, float deltaTim
     netForce = {0, 0};
 
     angularMomentum = glm::clamp(angularMomentum + torque * 0.5f * deltaTime, -MAX_ANGULAR_VEL * mass, MAX_ANGULAR_VEL * mass);
-    transform2D.transform2D.rotateBy(angularMomentum * invInertialMoment);
+    transform2D.transform2D.rotateBy(angularMomentum * invInertialMoment * (deltaTime / ANGULAR_REFERENCE_STEP));
     angularMomentum = angularMomentum + torque * 0.5f * deltaTime; // Will be clamped before rotation next step
 
     if (glm::abs(angularMomentum * invInertialMoment) < MIN_ANGULAR_VEL) {
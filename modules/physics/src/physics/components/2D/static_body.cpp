@@ -0,0 +1,37 @@
+#include "core/serialization/serializer_impl.h"
+
+#include "core/entity.h"
+#include "core/components/2d/global_transform.h"
+#include "physics/components/2D/static_body.h"
+#include "physics/components/2D/colliders/box_collider.h"
+#include "physics/components/2D/colliders/circle_collider.h"
+
+namespace phenyl::physics {
+    PHENYL_SERIALIZABLE(StaticBody2D)
+}
+
+using namespace phenyl;
+
+void physics::StaticBody2D::Move (core::Entity entity, glm::vec2 position) {
+    entity.apply<core::GlobalTransform2D>([entity, position] (core::GlobalTransform2D& transform) {
+        transform.transform2D.setPosition(position);
+        Sync(entity);
+    });
+}
+
+void physics::StaticBody2D::Sync (core::Entity entity) {
+    // Components may be inserted in any order, so do nothing until the body is complete
+    const auto* transform = entity.get<core::GlobalTransform2D>();
+    if (!transform || !entity.has<StaticBody2D>()) {
+        return;
+    }
+
+    if (auto* box = entity.get<BoxCollider2D>()) {
+        box->syncStatic(transform->transform2D.position());
+        box->applyFrameTransform(transform->transform2D.rotMatrix());
+    }
+
+    if (auto* circle = entity.get<CircleCollider2D>()) {
+        circle->syncStatic(transform->transform2D.position());
+    }
+}
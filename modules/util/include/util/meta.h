@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <type_traits>
 #include <functional>
 #include <tuple>
@@ -394,9 +395,10 @@ namespace phenyl::meta {
     namespace detail {
         struct curr_type_index {
         public:
+            // Types may be first seen on several threads at once, e.g. by runtimes running in parallel
             static std::size_t getNext () {
-                static std::size_t val = 1;
-                return val++;
+                static std::atomic<std::size_t> val = 1;
+                return val.fetch_add(1, std::memory_order_relaxed);
             }
         };
     }
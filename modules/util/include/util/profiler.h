@@ -5,8 +5,15 @@
 #include <string>
 
 namespace phenyl::util {
+    // Profiling state, including the timing function, is per thread
     void setProfilerTimingFunction (std::function<double(void)> timeFunc);
 
+    // Enables profiling of every system and render layer, which costs a profile of each every frame. Off by default,
+    // and shared by all threads.
+    void setDetailedProfiling (bool enabled);
+
+    bool detailedProfiling ();
+
     void startProfileFrame ();
 
     void endProfileFrame ();
@@ -19,4 +26,8 @@ namespace phenyl::util {
 
     double getProfileFrameTime ();
 
+    void setProfileCounter (const std::string& counter, double value);
+
+    double getProfileCounter (const std::string& counter);
+
 }
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "logging/logging.h"
+
+namespace phenyl::util {
+    // Stable LSD radix sort of data by the unsigned integer returned by key, one byte per pass. Bytes that are equal
+    // across every key are skipped. scratch must be at least as large as data, and the result always ends up in data.
+    template <typename T, typename KeyFn>
+    void RadixSort (std::span<T> data, std::span<T> scratch, KeyFn key) requires std::unsigned_integral<std::invoke_result_t<KeyFn, const T&>> {
+        using Key = std::invoke_result_t<KeyFn, const T&>;
+        static constexpr std::size_t PASSES = sizeof(Key);
+        static constexpr std::size_t RADIX = 256;
+
+        PHENYL_DASSERT(scratch.size() >= data.size());
+        if (data.size() <= 1) {
+            return;
+        }
+
+        // All histograms in one read of the keys
+        std::array<std::array<std::size_t, RADIX>, PASSES> counts{};
+        for (const auto& i : data) {
+            auto k = key(i);
+            for (std::size_t pass = 0; pass < PASSES; pass++) {
+                counts[pass][(k >> (pass * 8)) & 0xFF]++;
+            }
+        }
+
+        std::span<T> src = data;
+        std::span<T> dst = scratch.subspan(0, data.size());
+        for (std::size_t pass = 0; pass < PASSES; pass++) {
+            auto& passCounts = counts[pass];
+            if (passCounts[(key(src[0]) >> (pass * 8)) & 0xFF] == src.size()) {
+                // Every key has the same byte, order is unchanged
+                continue;
+            }
+
+            std::size_t offset = 0;
+            for (auto& i : passCounts) {
+                offset += std::exchange(i, offset);
+            }
+
+            for (auto& i : src) {
+                dst[passCounts[(key(i) >> (pass * 8)) & 0xFF]++] = std::move(i);
+            }
+            std::swap(src, dst);
+        }
+
+        if (src.data() != data.data()) {
+            std::move(src.begin(), src.end(), data.begin());
+        }
+    }
+}
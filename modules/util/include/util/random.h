@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <concepts>
 #include <cstdint>
+#include <memory>
 
 #include <random>
 
@@ -18,16 +19,18 @@ namespace phenyl::util {
 
     class Random {
     private:
-        static Random* INSTANCE;
+        // One generator per thread, so runtimes on their own threads neither race nor affect each other's sequences.
+        // Each is freed when its thread exits.
+        static thread_local std::unique_ptr<Random> INSTANCE;
 
         std::mt19937 random;
 
         static Random* GetInstance () {
             if (!INSTANCE) {
-                INSTANCE = new Random(std::random_device{});
+                INSTANCE = std::unique_ptr<Random>(new Random(std::random_device{}));
             }
 
-            return INSTANCE;
+            return INSTANCE.get();
         }
 
         explicit Random (std::random_device rd) : random{rd()} {}
@@ -66,12 +69,14 @@ namespace phenyl::util {
             std::shuffle(begin, end, random);
         }
     public:
+        // Seeds the generator of the calling thread
         static void Seed (std::uint32_t seed) {
             GetInstance()->seed(seed);
         }
 
+        // Frees the generator of the calling thread before the thread exits
         static void Cleanup () {
-            delete INSTANCE;
+            INSTANCE.reset();
         }
 
         template <typename T>
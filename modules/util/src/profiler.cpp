@@ -1,3 +1,5 @@
+#include <atomic>
+#include <chrono>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -11,6 +13,11 @@ using namespace phenyl;
 
 static Logger LOGGER{"PROFILER", util::detail::UTIL_LOGGER};
 
+// Used until a renderer provides its own clock, so that runtimes without one can still be profiled
+static double SteadyClockTime () {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
 struct Profiler {
       double lastFrameTime = 0;
       double frameStartTime = 0;
@@ -25,16 +32,29 @@ struct Profiler {
 
       std::unordered_set<std::string> activeSet;
 
-      std::function<double(void)> timeFunc;
+      std::unordered_map<std::string, double> counters;
+
+      std::function<double(void)> timeFunc = SteadyClockTime;
 
 };
 
-static Profiler profiler;
+// Each thread profiles separately, so runtimes stepping on their own threads do not share a profiler
+static thread_local Profiler profiler;
+
+static std::atomic<bool> detailedProfilingEnabled{false};
 
 void util::setProfilerTimingFunction (std::function<double ()> timeFunc) {
     profiler.timeFunc = std::move(timeFunc);
 }
 
+void util::setDetailedProfiling (bool enabled) {
+    detailedProfilingEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool util::detailedProfiling () {
+    return detailedProfilingEnabled.load(std::memory_order_relaxed);
+}
+
 void util::startProfileFrame () {
     profiler.frameStartTime = profiler.timeFunc();
 }
@@ -90,4 +110,13 @@ double util::getProfileTime (const std::string& category) {
 
 double util::getProfileFrameTime () {
     return profiler.lastFrameTime;
-}
\ No newline at end of file
+}
+
+void util::setProfileCounter (const std::string& counter, double value) {
+    profiler.counters[counter] = value;
+}
+
+double util::getProfileCounter (const std::string& counter) {
+    auto it = profiler.counters.find(counter);
+    return it != profiler.counters.end() ? it->second : 0.0;
+}
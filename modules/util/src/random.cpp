@@ -1,3 +1,3 @@
 #include "util/random.h"
 
-phenyl::util::Random* phenyl::util::Random::INSTANCE = nullptr;
\ No newline at end of file
+thread_local std::unique_ptr<phenyl::util::Random> phenyl::util::Random::INSTANCE;
\ No newline at end of file
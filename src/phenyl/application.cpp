@@ -19,8 +19,10 @@ core::World& engine::ApplicationBase::world () {
 void engine::ApplicationBase::setTargetFPS (double fps) {
     if (fps <= 0) {
         targetFrameTime = 0;
+        targetFps = 0;
     } else {
         targetFrameTime = 1.0 / fps;
+        targetFps = fps;
     }
 }
 
@@ -28,10 +30,24 @@ void engine::ApplicationBase::setFixedTimeScale (double newTimeScale) {
     fixedTimeScale = newTimeScale;
 }
 
+void engine::ApplicationBase::setFixedFPS (double fps) {
+    PHENYL_ASSERT_MSG(fps > 0, "Fixed timestep rate must be positive, got {}", fps);
+    fixedFps = fps;
+}
+
+void engine::ApplicationBase::setMaxFixedSteps (std::size_t steps) {
+    PHENYL_ASSERT_MSG(steps > 0, "Must allow at least one fixed timestep per frame");
+    maxFixedSteps = steps;
+}
+
 void engine::ApplicationBase::pause () {
     setFixedTimeScale(0.0);
 }
 
 void engine::ApplicationBase::resume () {
     setFixedTimeScale(1.0);
-}
\ No newline at end of file
+}
+
+void engine::ApplicationBase::quit () {
+    quitRequested = true;
+}
@@ -1,4 +1,5 @@
 #include <chrono>
+#include <cmath>
 #include <exception>
 #include <fstream>
 #include <thread>
@@ -7,32 +8,53 @@
 #include "graphics/renderer.h"
 #include "logging/logging.h"
 #include "plugins/app_plugin.h"
+#include "core/assets/assets.h"
 #include "core/runtime.h"
+#include "core/transform_interpolation_2d.h"
 #include "util/profiler.h"
 
 #include "phenyl/engine.h"
 
-#define FIXED_FPS 60.0
-
 using namespace phenyl;
 
 static Logger LOGGER{"ENGINE", PHENYL_LOGGER};
 
 class engine::Engine {
 private:
-    std::unique_ptr<graphics::Renderer> renderer;
+    // Constructed first, as the renderer registers its assets with the runtime. Destruction must go in this order:
+    // 1. runtime.shutdown() destroys the entities, plugins and resources of the runtime, which own renderer objects
+    // 2. renderer->clearLayers() destroys the render layers
+    // 3. The renderer, and with it the graphics context. Its assets are released to the runtime's Assets, bound for it
+    // 4. The runtime, which no longer owns any renderer objects
+    // Steps 1 to 3 are done by ~Engine(), before the members are destroyed.
     core::PhenylRuntime runtime;
+    std::unique_ptr<graphics::Renderer> renderer;
 
+    bool headless;
     double lastTime;
     double deltaTime{0.0};
     double fixedTimeSlop{0.0};
+
+    static std::unique_ptr<graphics::Renderer> MakeRenderer (core::PhenylRuntime& runtime, const graphics::GraphicsProperties& properties) {
+        // Renderers register their shaders with the runtime's assets
+        auto assetScope = runtime.makeCurrent();
+        if (properties.isHeadless()) {
+            PHENYL_LOGI(LOGGER, "Starting headless");
+            return graphics::MakeNullRenderer(properties);
+        } else {
+            return graphics::MakeGLRenderer(properties);
+        }
+    }
 public:
-    explicit Engine (const ApplicationProperties& properties) : renderer{graphics::MakeGLRenderer(properties.graphicsProperties)}, runtime(), lastTime{renderer->getCurrentTime()} {}
+    explicit Engine (const ApplicationProperties& properties) : runtime(), renderer{MakeRenderer(runtime, properties.graphicsProperties)}, headless{properties.graphicsProperties.isHeadless()}, lastTime{renderer->getCurrentTime()} {}
 
     ~Engine() {
         PHENYL_LOGI(LOGGER, "Shutting down!");
         runtime.shutdown();
         renderer->clearLayers();
+
+        auto assetScope = runtime.makeCurrent();
+        renderer.reset();
     }
 
     core::PhenylRuntime& getRuntime () {
@@ -49,8 +71,10 @@ public:
 
     void gameloop (ApplicationBase* app) {
         //double deltaPhysicsFrame = 0.0f;
+        // The renderer also uses the runtime's assets outside of its stages
+        auto assetScope = runtime.makeCurrent();
         PHENYL_LOGD(LOGGER, "Starting loop!");
-        while (!renderer->getViewport().shouldClose()) {
+        while (!app->isQuitting() && !renderer->getViewport().shouldClose()) {
             PHENYL_TRACE(LOGGER, "Frame start");
             util::startProfileFrame();
 
@@ -58,24 +82,34 @@ public:
 
             //double deltaTime = graphics->getDeltaTime();
             fixedTimeSlop += deltaTime * app->getFixedTimeScale();
+            auto fixedDelta = 1.0 / app->getFixedFps();
 
             util::startProfile("physics");
-            while (fixedTimeSlop >= 1.0 / FIXED_FPS) {
+            std::size_t fixedSteps = 0;
+            while (fixedTimeSlop >= fixedDelta && fixedSteps < app->getMaxFixedSteps()) {
                 PHENYL_TRACE(LOGGER, "Physics frame start");
-                fixedUpdate();
-                fixedTimeSlop -= 1.0 / FIXED_FPS;
+                fixedUpdate(fixedDelta);
+                fixedTimeSlop -= fixedDelta;
+                fixedSteps++;
                 PHENYL_TRACE(LOGGER, "Physics frame end");
             }
+
+            if (fixedTimeSlop >= fixedDelta) {
+                // Catching up any further would make the next frame slower still, so drop the time instead
+                PHENYL_LOGD(LOGGER, "Dropped {}s of fixed timesteps after {} steps", fixedTimeSlop - std::fmod(fixedTimeSlop, fixedDelta), fixedSteps);
+                fixedTimeSlop = std::fmod(fixedTimeSlop, fixedDelta);
+            }
+            util::setProfileCounter("engine.fixed_steps", static_cast<double>(fixedSteps));
             util::endProfile();
 
             util::startProfile("graphics");
             update(deltaTime);
-            render(deltaTime);
+            render(fixedTimeSlop / fixedDelta);
             util::endProfile();
 
             util::endProfileFrame();
 
-            sync(app->getTargetFps()); // TODO
+            sync(app);
             renderer->getViewport().poll();
             PHENYL_TRACE(LOGGER, "Frame end");
         }
@@ -86,21 +120,42 @@ public:
         runtime.runVariableTimestep(deltaTime);
         PHENYL_TRACE(LOGGER, "Update end");
     }
-    void fixedUpdate () {
+    void fixedUpdate (double fixedDelta) {
         PHENYL_TRACE(LOGGER, "Fixed update start");
-        runtime.runFixedTimestep(1.0 / FIXED_FPS);
+        if (auto* interpolation = runtime.resources().resourceMaybe<core::TransformInterpolation2D>()) {
+            interpolation->snapshot();
+        }
+        runtime.runFixedTimestep(fixedDelta);
         PHENYL_TRACE(LOGGER, "Fixed update end");
     }
 
-    void render (double deltaTime) {
+    // alpha is how far the simulation has been advanced through the next fixed timestep
+    void render (double alpha) {
         PHENYL_TRACE(LOGGER, "Render start");
+        auto* interpolation = runtime.resources().resourceMaybe<core::TransformInterpolation2D>();
+        if (interpolation) {
+            interpolation->apply(alpha);
+        }
+
         runtime.runRender();
         renderer->render();
+
+        if (interpolation) {
+            interpolation->restore();
+        }
         PHENYL_TRACE(LOGGER, "Render end");
     }
 
-    void sync (double fps) {
-        while (renderer->getCurrentTime() - lastTime < 1.0 / (fps)) {
+    void sync (ApplicationBase* app) {
+        auto fps = app->getTargetFps();
+        if (headless && fps <= 0) {
+            // Unpaced, so advance by exactly one fixed timestep per frame rather than by however long the frame took
+            deltaTime = 1.0 / app->getFixedFps();
+            lastTime = renderer->getCurrentTime();
+            return;
+        }
+
+        while (fps > 0 && renderer->getCurrentTime() - lastTime < 1.0 / fps) {
             std::this_thread::sleep_for(std::chrono::microseconds(100));
         }
         double currTime = renderer->getCurrentTime();
@@ -10,6 +10,7 @@
 #include "core/plugins/core_plugin_2d.h"
 #include "core/plugins/input_plugin.h"
 #include "core/plugins/timed_lifetime_plugin.h"
+#include "core/plugins/transform_interpolation_plugin_2d.h"
 
 using namespace phenyl;
 
@@ -26,6 +27,7 @@ void Default2DPlugin::init (PhenylRuntime& runtime) {
     runtime.addPlugin<audio::AudioPlugin>();
     runtime.addPlugin<graphics::ProfileUiPlugin>();
     runtime.addPlugin<core::InputPlugin>();
+    runtime.addPlugin<core::TransformInterpolation2DPlugin>();
 
     // TODO: move when adding more default components
     runtime.addPlugin<core::TimedLifetimePlugin>();